@@ -1,6 +1,6 @@
 #include "App.h"
 
-App::App() : _mqtt(_wifiClient), _frisquetManager(_radio, _cfg, _mqtt) {}
+App::App() : _mqtt(_wifiClient), _frisquetManager(_radio, _cfg, _mqtt), _radio(_sx1262), _archive(_radio.trames()) {}
 
 void App::begin() {
   Serial.begin(115200);
@@ -8,6 +8,10 @@ void App::begin() {
 
   Heltec.begin(false /*DisplayEnable disable*/, false /*LoRa Disable*/, true /*Serial Enable*/);
 
+  // Sortie série des logs vidée en tâche de fond
+  logs.startSerialTask();
+  _archive.begin();
+
   initConfig();
   initNetwork();
   initMqtt();
@@ -15,15 +19,16 @@ void App::begin() {
   initOta();
 
   _frisquetManager.begin();
+  _frisquetManager.startTask();
 }
 
 void App::loop() {
-  // boucle des services
+  // boucle des services réseau, la pile radio tourne sur sa propre tâche
   _networkManager.loop();
   _ota.loop();
   _portal->loop();
   _mqtt.loop();
-  _frisquetManager.loop();
+  _archive.loop();
   delay(10);
 }
 
@@ -46,15 +51,26 @@ void App::initNetwork() {
 
 void App::initMqtt() {
   _mqtt.begin(_cfg.getMQTTOptions());
+  // La boucle principale reste propriétaire du client MQTT
+  if (!_mqtt.enableQueues()) {
+    error("[MQTT] Impossible de créer les files de messages.");
+  }
 }
 
 void App::initPortal() {
-  _portal = new Portal(_frisquetManager);
+  _portal = new Portal(_frisquetManager, _archive);
   _portal->begin(/*startApFallbackIfNoWifi=*/true);
 
   info("[PORTAIL] Portail initialisé.");
 }
 
 void App::initOta() {
-  _ota.begin(_networkManager.hostname().c_str());
+  _ota.begin(_networkManager.hostname().c_str(), [this](bool systemeFichiers) {
+    // La partition des logs est réécrite par une mise à jour du système de fichiers
+    if (systemeFichiers) {
+      _archive.end();
+    } else {
+      _archive.flush();
+    }
+  });
 }
\ No newline at end of file
@@ -9,7 +9,9 @@
 #include "Portal.h"
 #include "Logs.h"
 #include "OTA.h"
+#include "LogArchive.h"
 
+#include "Radio.h"
 #include "Frisquet/FrisquetRadio.h"
 #include "FrisquetManager.h"
 
@@ -34,8 +36,12 @@ private:
   Portal* _portal = nullptr;
 
   // Radio
+  Radio _sx1262;
   FrisquetRadio _radio;
 
+  // Logs et trames conservés en flash
+  LogArchive _archive;
+
   // Étapes
   void initConfig();
   void initNetwork();
@@ -68,6 +68,15 @@ void Config::load() {
   _useZone2 = _preferences.getBool("useZone2", false);
   _useZone3 = _preferences.getBool("useZone3", false);
 
+  // Radio
+  _radioOffsetKHz = _preferences.getFloat("radioOffset", 0.0f);
+  _radioRxBandwidthKHz = _preferences.getFloat("radioRxBw", RadioTransport::kRxBandwidthKHz);
+
+  // Relevés
+  _releveMinSec = _preferences.getUShort("releveMin", 60);
+  _releveMaxSec = _preferences.getUShort("releveMax", 900);
+  _ackDeadlineMs = _preferences.getUShort("ackDeadline", AckTurnaround::kDelaiMaxDefautMs);
+
   _preferences.end();
   delay(100);
 
@@ -130,5 +139,14 @@ void Config::save() {
   _preferences.putBool("useZone2", _useZone2);
   _preferences.putBool("useZone3", _useZone3);
 
+  // Radio
+  _preferences.putFloat("radioOffset", _radioOffsetKHz);
+  _preferences.putFloat("radioRxBw", _radioRxBandwidthKHz);
+
+  // Relevés
+  _preferences.putUShort("releveMin", _releveMinSec);
+  _preferences.putUShort("releveMax", _releveMaxSec);
+  _preferences.putUShort("ackDeadline", _ackDeadlineMs);
+
   _preferences.end();
 }
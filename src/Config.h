@@ -4,6 +4,8 @@
 #include "NetworkManager.h"
 #include "MQTT/MqttManager.h"
 #include "Frisquet/NetworkID.h"
+#include "RadioTransport.h"
+#include "Frisquet/AckTurnaround.h"
 
 class Config {
     private:
@@ -26,6 +28,14 @@ class Config {
         bool _useZone1 = true;
         bool _useZone2 = false;
         bool _useZone3 = false;
+
+        float _radioOffsetKHz = 0.0f;
+        float _radioRxBandwidthKHz = RadioTransport::kRxBandwidthKHz;
+
+        uint16_t _releveMinSec = 60;
+        uint16_t _releveMaxSec = 900;
+
+        uint16_t _ackDeadlineMs = AckTurnaround::kDelaiMaxDefautMs;
     public:
         Config();
         void load();
@@ -62,4 +72,20 @@ class Config {
         bool useZone2(bool useZone2) { _useZone2 = useZone2; return _useZone2; }
         bool useZone3() { return _useZone3; }
         bool useZone3(bool useZone3) { _useZone3 = useZone3; return _useZone3; }
+
+        // Calibration radio : écart de fréquence du quartz et bande passante retenue
+        float radioOffsetKHz() { return _radioOffsetKHz; }
+        void radioOffsetKHz(float radioOffsetKHz) { _radioOffsetKHz = radioOffsetKHz; }
+        float radioRxBandwidthKHz() { return _radioRxBandwidthKHz; }
+        void radioRxBandwidthKHz(float radioRxBandwidthKHz) { _radioRxBandwidthKHz = radioRxBandwidthKHz; }
+
+        // Bornes de la période de relevé des températures Connect, adaptée à leur variation
+        uint16_t releveMinSec() { return _releveMinSec; }
+        void releveMinSec(uint16_t releveMinSec) { _releveMinSec = releveMinSec; }
+        uint16_t releveMaxSec() { return _releveMaxSec; }
+        void releveMaxSec(uint16_t releveMaxSec) { _releveMaxSec = releveMaxSec; }
+
+        // Délai maximal entre la réception d'une trame et la fin d'émission de son accusé
+        uint16_t ackDeadlineMs() { return _ackDeadlineMs; }
+        void ackDeadlineMs(uint16_t ackDeadlineMs) { _ackDeadlineMs = ackDeadlineMs; }
 };
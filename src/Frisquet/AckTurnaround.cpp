@@ -0,0 +1,49 @@
+#include "AckTurnaround.h"
+#include "Trames.h"
+
+AckTurnaround::TYPE AckTurnaround::typeDe(uint8_t typeMessage) {
+    switch(typeMessage) {
+        case RadioMessageType::READ: return TYPE::READ;
+        case RadioMessageType::INIT: return TYPE::INIT;
+        case RadioMessageType::ASSOCIATION: return TYPE::ASSOCIATION;
+    }
+    return TYPE::AUTRE;
+}
+
+const char* AckTurnaround::nomType(TYPE type) {
+    switch(type) {
+        case TYPE::READ: return "read";
+        case TYPE::INIT: return "init";
+        case TYPE::ASSOCIATION: return "association";
+        default: return "other";
+    }
+}
+
+bool AckTurnaround::enregistrer(uint8_t typeMessage, uint32_t receptionUs, uint32_t finEmissionUs) {
+    uint32_t delaiUs = finEmissionUs - receptionUs;
+    _dernierUs = delaiUs;
+
+    Mesures& mesures = _mesures[typeDe(typeMessage)];
+    ++mesures.accuses;
+    mesures.moyenneUs = mesures.accuses == 1 ? delaiUs : (mesures.moyenneUs * 7 + delaiUs) / 8;
+    if(delaiUs > mesures.maxUs) {
+        mesures.maxUs = delaiUs;
+    }
+
+    size_t classe = delaiUs / 1000 / kClasseMs;
+    ++mesures.histogramme[classe < kClasses ? classe : kClasses - 1];
+
+    if(delaiUs <= _delaiMaxUs) {
+        return false;
+    }
+    ++mesures.depassements;
+    return true;
+}
+
+uint32_t AckTurnaround::depassements() const {
+    uint32_t total = 0;
+    for(const Mesures& mesures : _mesures) {
+        total += mesures.depassements;
+    }
+    return total;
+}
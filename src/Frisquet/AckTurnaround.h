@@ -0,0 +1,50 @@
+#pragma once
+
+#include <heltec.h>
+
+// Délai de réponse des appareils émulés (Connect, satellite virtuel) : de
+// l'interruption DIO de la trame reçue à la fin d'émission de l'accusé, par type
+// de message. Un accusé émis après le délai maximal est compté comme dépassement :
+// la chaudière risque de l'avoir déjà abandonné et de réémettre.
+class AckTurnaround {
+    public:
+        static constexpr uint16_t kDelaiMaxDefautMs = 100;
+
+        static constexpr uint32_t kClasseMs = 10;       // Histogramme : classes de 10 ms
+        static constexpr size_t kClasses = 16;          // 0 .. 150 ms et au-delà
+
+        enum TYPE : uint8_t {
+            READ,
+            INIT,
+            ASSOCIATION,
+            AUTRE,
+            NB_TYPES
+        };
+
+        struct Mesures {
+            uint32_t accuses = 0;
+            uint32_t depassements = 0;
+            uint32_t moyenneUs = 0;     // Moyenne glissante
+            uint32_t maxUs = 0;
+            uint32_t histogramme[kClasses] = {0};
+        };
+
+        // Accusé émis : horodatages micros() de la réception (DIO) et de la fin d'émission ;
+        // true si le délai maximal est dépassé
+        bool enregistrer(uint8_t typeMessage, uint32_t receptionUs, uint32_t finEmissionUs);
+
+        void setDelaiMaxMs(uint16_t delaiMaxMs) { _delaiMaxUs = (uint32_t)delaiMaxMs * 1000; }
+        uint32_t delaiMaxUs() const { return _delaiMaxUs; }
+
+        const Mesures& mesures(TYPE type) const { return _mesures[type]; }
+        uint32_t dernierUs() const { return _dernierUs; }
+        uint32_t depassements() const;
+
+        static TYPE typeDe(uint8_t typeMessage);
+        static const char* nomType(TYPE type);
+
+    private:
+        Mesures _mesures[NB_TYPES];
+        uint32_t _delaiMaxUs = (uint32_t)kDelaiMaxDefautMs * 1000;
+        uint32_t _dernierUs = 0;
+};
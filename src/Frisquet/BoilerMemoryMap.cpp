@@ -0,0 +1,108 @@
+#include "BoilerMemoryMap.h"
+#include "Trames.h"
+#include "../RadioTransport.h"
+
+void BoilerMemoryMap::enregistrer(uint16_t adresse, const byte* donnees, uint16_t mots, SOURCE source) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t now = millis();
+
+    for(uint16_t i = 0; i < mots; i++) {
+        uint16_t cle = adresse + i;
+        if(_entrees.size() >= kCapacite && _entrees.find(cle) == _entrees.end()) {
+            evincer();
+        }
+
+        Entree& entree = _entrees[cle];
+        entree.valeur = (uint16_t)(donnees[i * 2] << 8 | donnees[i * 2 + 1]);
+        entree.horodatage = now;
+        entree.source = source;
+    }
+}
+
+void BoilerMemoryMap::enregistrerReponse(uint16_t adresse, uint16_t taille, const byte* trame, size_t length, SOURCE source) {
+    size_t entete = sizeof(RadioTrameHeader) + 1;
+    if(length < entete) {
+        return;
+    }
+
+    uint8_t longueurDonnees = trame[sizeof(RadioTrameHeader)];
+    if(length < entete + longueurDonnees) {
+        longueurDonnees = length - entete;
+    }
+
+    uint16_t mots = longueurDonnees / 2;
+    if(mots > taille) {
+        mots = taille;
+    }
+    enregistrer(adresse, &trame[entete], mots, source);
+}
+
+bool BoilerMemoryMap::lire(uint16_t adresse, uint16_t mots, byte* donnees, uint32_t ageMaxMs) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t now = millis();
+
+    for(uint16_t i = 0; i < mots; i++) {
+        auto it = _entrees.find((uint16_t)(adresse + i));
+        if(it == _entrees.end() || now - it->second.horodatage > ageMaxMs) {
+            ++_misses;
+            return false;
+        }
+        donnees[i * 2] = it->second.valeur >> 8;
+        donnees[i * 2 + 1] = it->second.valeur & 0xFF;
+    }
+
+    ++_hits;
+    return true;
+}
+
+bool BoilerMemoryMap::lireMot(uint16_t adresse, Entree& entree) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entrees.find(adresse);
+    if(it == _entrees.end()) {
+        return false;
+    }
+    entree = it->second;
+    return true;
+}
+
+bool BoilerMemoryMap::estFrais(uint16_t adresse, uint32_t ageMaxMs) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entrees.find(adresse);
+    return it != _entrees.end() && millis() - it->second.horodatage <= ageMaxMs;
+}
+
+bool BoilerMemoryMap::lireReponse(uint16_t adresse, uint16_t taille, byte* trame, size_t& length, uint32_t ageMaxMs) {
+    size_t entete = sizeof(RadioTrameHeader) + 1;
+    if(entete + taille * 2 > RADIOLIB_SX126X_MAX_PACKET_LENGTH) {
+        return false;
+    }
+    if(!lire(adresse, taille, &trame[entete], ageMaxMs)) {
+        return false;
+    }
+
+    RadioTrameHeader header;
+    memcpy(trame, &header, sizeof(header));
+    trame[sizeof(header)] = (uint8_t)(taille * 2);
+    length = entete + taille * 2;
+    return true;
+}
+
+size_t BoilerMemoryMap::size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entrees.size();
+}
+
+void BoilerMemoryMap::evincer() {
+    // Cache plein : le mot le plus ancien laisse sa place
+    auto plusAncien = _entrees.begin();
+    uint32_t now = millis();
+    for(auto it = _entrees.begin(); it != _entrees.end(); ++it) {
+        if(now - it->second.horodatage > now - plusAncien->second.horodatage) {
+            plusAncien = it;
+        }
+    }
+    if(plusAncien != _entrees.end()) {
+        _entrees.erase(plusAncien);
+        ++_evictions;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <heltec.h>
+#include <map>
+#include <mutex>
+
+// Copie locale de la mémoire chaudière : chaque mot lu, écouté ou écrit est conservé
+// avec son horodatage et sa provenance, pour servir les lectures encore fraîches
+// sans nouvelle transaction radio.
+class BoilerMemoryMap {
+    public:
+        enum SOURCE : uint8_t {
+            LECTURE_ACTIVE,     // Réponse à une lecture émise par le module
+            ECOUTE_PASSIVE,     // Échange entre la chaudière et un autre appareil
+            ECHO_ECRITURE       // Valeur écrite par le module, acquittée par la chaudière
+        };
+
+        struct Entree {
+            uint16_t valeur = 0;
+            uint32_t horodatage = 0;    // millis() à l'enregistrement
+            SOURCE source = SOURCE::LECTURE_ACTIVE;
+        };
+
+        static constexpr size_t kCapacite = 512;
+
+        // Mots consécutifs en big-endian, tels que transmis dans les trames
+        void enregistrer(uint16_t adresse, const byte* donnees, uint16_t mots, SOURCE source);
+
+        // Réponse READ/INIT complète (en-tête, longueur, données) pour la zone adresse/taille
+        void enregistrerReponse(uint16_t adresse, uint16_t taille, const byte* trame, size_t length, SOURCE source);
+
+        // true si tous les mots sont connus et plus récents que ageMaxMs
+        bool lire(uint16_t adresse, uint16_t mots, byte* donnees, uint32_t ageMaxMs);
+        bool lireMot(uint16_t adresse, Entree& entree);
+        bool estFrais(uint16_t adresse, uint32_t ageMaxMs);
+
+        // Reconstitue une trame de réponse (en-tête neutre) à partir du cache
+        bool lireReponse(uint16_t adresse, uint16_t taille, byte* trame, size_t& length, uint32_t ageMaxMs);
+
+        size_t size();
+        uint32_t getHits() const { return _hits; }
+        uint32_t getMisses() const { return _misses; }
+        uint32_t getEvictions() const { return _evictions; }
+
+    private:
+        void evincer();
+
+        std::map<uint16_t, Entree> _entrees;
+        std::mutex _mutex;              // Alimenté par la tâche radio, lu par le portail
+
+        uint32_t _hits = 0;
+        uint32_t _misses = 0;
+        uint32_t _evictions = 0;
+};
@@ -1,5 +1,6 @@
 #include "Connect.h"
 #include "../Buffer.h"
+#include "Schemas.h"
 #include <cstring>
 #include <math.h>
 
@@ -45,11 +46,16 @@ bool Connect::envoyerZone(Zone& zone) {
 
     info("[CONNECT] Envoi de la zone %d.", zone.getNumeroZone());
 
-    if(zone.getIdZone() == ID_ZONE_1 && getConfig().useSatelliteVirtualZ1()) {
-        return true;
-    } else if(zone.getIdZone() == ID_ZONE_2 && getConfig().useSatelliteVirtualZ2()) {
-        return true;
-    } else if(zone.getIdZone() == ID_ZONE_3 && getConfig().useSatelliteVirtualZ3()) {
+    auto onEnvoiReussi = [&zone]() {
+        info("[CONNECT] Envoi réussi !");
+        zone.publishMqtt();
+        zone.refreshLastEnvoi();
+    };
+
+    if((zone.getIdZone() == ID_ZONE_1 && getConfig().useSatelliteVirtualZ1()) ||
+       (zone.getIdZone() == ID_ZONE_2 && getConfig().useSatelliteVirtualZ2()) ||
+       (zone.getIdZone() == ID_ZONE_3 && getConfig().useSatelliteVirtualZ3())) {
+        onEnvoiReussi();
         return true;
     }
     
@@ -81,169 +87,62 @@ bool Connect::envoyerZone(Zone& zone) {
     payload.mode = zone.getMode();
     payload.modeOptions = zone.getModeOptions();
     
-    byte buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-    size_t length = 0;
-    int16_t err;
-
-    uint8_t retry = 0;
-    do {
-        err = this->radio().sendInit(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            zone.getIdZone(), 
-            0xA154,
-            0x0018,
-            0xa154,
-            0x0003,
-            (byte*)&payload,
-            sizeof(payload),
-            buff,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(100);
-            continue;
-        }
-        
-        return true;
-    } while(retry++ < 1);
+    uint32_t id = this->radio().submitInit(
+        this->getId(), 
+        ID_CHAUDIERE, 
+        this->getIdAssociation(),
+        this->incrementIdMessage(),
+        zone.getIdZone(), 
+        0xA154,
+        0x0018,
+        0xa154,
+        0x0003,
+        (byte*)&payload,
+        sizeof(payload),
+        [&zone, onEnvoiReussi](int16_t err, const byte* donnees, size_t length) {
+            if(err != RADIOLIB_ERR_NONE) {
+                error("[CONNECT] Échec de l'envoi de la zone %d (err %d).", zone.getNumeroZone(), err);
+                return;
+            }
+            onEnvoiReussi();
+        },
+        DutyCycle::PRIORITE::UTILISATEUR
+    );
 
-    return false;
+    return id != 0;
 }
 
 bool Connect::recupererInformations() {
-    if(! estAssocie()) {
-        return false;
-    }
-
-    struct {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueurDonnees;
-        temperature16 temperatureECS;
-        temperature16 temperatureCDC;
-        temperature16 temperatureDepartZ1;
-        temperature16 temperatureDepartZ2;
-        temperature16 temperatureDepartZ3;
-        temperature16 temperatureInconnue1;
-        temperature16 temperatureInconnue2;
-        temperature16 temperatureInconnue3;
-        temperature16 temperatureInconnue4;
-        temperature16 temperatureInconnue5;
-        pression16 pression;
-        byte i1[1] = {0};
-        byte modeECS;
-        temperature16 temperatureECSInstant;
-        byte i2[10] = {0};
-        temperature16 temperatureAmbianteZ1;
-        temperature16 temperatureAmbianteZ2;
-        temperature16 temperatureAmbianteZ3;
-        byte i3[6] = {0};
-        temperature16 temperatureConsigneZ1;
-        temperature16 temperatureConsigneZ2;
-        temperature16 temperatureConsigneZ3;
-        temperature16 temperatureExterieure;
-    } buff;
-
-    size_t length;
-    int16_t err;
-
-    uint8_t retry = 0;
-    do {
-        length = sizeof(buff);
-        err = this->radio().sendAsk(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01,
-            0x79E0 + (ID_CHAUDIERE == 0x84 ? 0xC8 : 0x00),
-            0x001C,
-            (byte*)&buff,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(100);
-            continue;
-        }
-
-        if(getZone1().getSource() == Zone::SOURCE::CONNECT) {
-            getZone1().setTemperatureAmbiante(buff.temperatureAmbianteZ1.toFloat());
-            getZone1().setTemperatureConsigne(buff.temperatureConsigneZ1.toFloat());
-        }
-        getZone1().setTemperatureDepart(buff.temperatureDepartZ1.toFloat());
-
-        if(getZone2().getSource() == Zone::SOURCE::CONNECT) {
-            getZone2().setTemperatureAmbiante(buff.temperatureAmbianteZ2.toFloat());
-            getZone2().setTemperatureConsigne(buff.temperatureConsigneZ2.toFloat());
-        }
-        getZone2().setTemperatureDepart(buff.temperatureDepartZ2.toFloat());
-
-        if(getZone3().getSource() == Zone::SOURCE::CONNECT) {
-            getZone3().setTemperatureAmbiante(buff.temperatureAmbianteZ3.toFloat());
-            getZone3().setTemperatureConsigne(buff.temperatureConsigneZ3.toFloat());
-        }
-        getZone3().setTemperatureDepart(buff.temperatureDepartZ3.toFloat());
-
-        setTemperatureExterieure(buff.temperatureExterieure.toFloat());
-        setTemperatureECS(buff.temperatureECS.toFloat());
-        setTemperatureCDC(buff.temperatureCDC.toFloat());
-
-        setPression(buff.pression.toFloat());
-        return true;
-    } while(retry++ < 1);
-
-    return false;
+    return radio().lectures().demander(_besoinInformations);
 }
 
 bool Connect::recupererConsommation() {
-    if(! estAssocie()) {
-        return false;
-    }
-
-    struct {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueurDonnees;
-        byte i1[18] = {0};
-        fword consommationECS;
-        fword consommationChauffage;
-        byte i2[34] = {0};
-    } buff;
-    
-
-    size_t length;
-    int16_t err;
-
-    uint8_t retry = 0;
-    do {
-        length = sizeof(buff);
-        err = this->radio().sendAsk(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01,
-            0x7A18 + (ID_CHAUDIERE == 0x84 ? 0xC8 : 0x00),
-            0x001C,
-            (byte*)&buff,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(100);
-            continue;
-        }
-        
-        setConsommationChauffage(buff.consommationChauffage.toInt16());
-        setConsommationECS(buff.consommationECS.toInt16());
-        
-        return true;
-    } while(retry++ < 1);
+    return radio().lectures().demander(_besoinConsommation);
+}
 
-    return false;
+void Connect::declarerLectures() {
+    // Relevés confiés au planificateur : informations et consommations sont voisines
+    // en mémoire et peuvent être lues dans une seule transaction
+    auto traiter = [this](uint16_t adresseMemoire) {
+        return [this, adresseMemoire](int16_t err, const byte* donnees, size_t length) {
+            if(err == RADIOLIB_ERR_NONE && handleReadResponse(adresseMemoire, donnees, length)) {
+                return;
+            }
+            error("[CONNECT] Échec de la lecture mémoire 0x%04X (err %d).", adresseMemoire, err);
+        };
+    };
+
+    uint16_t decalage = ID_CHAUDIERE == 0x84 ? 0xC8 : 0x00;
+    ReadPlanner& lectures = radio().lectures();
+    _besoinInformations = lectures.declarer("températures", *this, SchemaInformations::adresse + decalage, SchemaInformations::taille, 300000, traiter(SchemaInformations::adresse + decalage)); // 5 minutes
+    _besoinConsommation = lectures.declarer("consommations", *this, SchemaConsommation::adresse + decalage, SchemaConsommation::taille, 3600000, traiter(SchemaConsommation::adresse + decalage)); // 1 heure
+    _besoinModeECS = lectures.declarer("mode ECS", *this, SchemaModeECS::adresse, SchemaModeECS::taille, 3600000, traiter(SchemaModeECS::adresse)); // 1 heure
+
+    // Températures entre les bornes configurées ; consommations entre la borne haute et 1 heure
+    uint32_t minimum = (uint32_t)getConfig().releveMinSec() * 1000;
+    uint32_t maximum = (uint32_t)getConfig().releveMaxSec() * 1000;
+    lectures.bornerPeriode(_besoinInformations, minimum, maximum);
+    lectures.bornerPeriode(_besoinConsommation, maximum < 3600000 ? maximum : 3600000, 3600000);
 }
 
 void Connect::setTemperatureExterieure(float temperature) {
@@ -293,46 +192,7 @@ bool Connect::recupererModeECS() {
     7E 80 AA 22 05 10 A0 F0 00 0D 1A 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 19 // eco+
     */
     // Demande récupération courte : 80 7E AA 03 01 03 A0 FC 00 01
-    struct {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueurDonnees;
-        byte i1;
-        byte modeECS;
-    } buff;
-    
-
-    size_t length = 0;
-    int16_t err;
-
-    uint8_t retry = 0;
-    do {
-        //length = sizeof(buff);
-        err = this->radio().sendAsk(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01,
-            0xA0FC,
-            0x0001,
-            (byte*)&buff,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(10);
-            continue;
-        }
-        
-        uint8_t raw = buff.modeECS;
-        uint8_t masked = raw & 0x7F;
-        info("[CONNECT] modeECS reçu brut=0x%02X, masqué=0x%02X", raw, masked);
-        setModeECS((MODE_ECS)masked);
-
-        return true;
-    } while(retry++ < 1);
-
-    return false;
+    return radio().lectures().demander(_besoinModeECS);
 }
 
 Connect::MODE_ECS Connect::getModeECS() {
@@ -399,180 +259,124 @@ bool Connect::envoyerModeECS() {
     } payload;
     
     payload.modeECS = getModeECS();
-    
-    byte buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-    size_t length = 0;
-    int16_t err;
-
-    uint8_t retry = 0;
-    do {
-        err = this->radio().sendInit(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01, 
-            0xA0FC,
-            0x0001,
-            0xA0FC,
-            0x0001,
-            (byte*)&payload,
-            sizeof(payload),
-            buff,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(100);
-            continue;
-        }
-        
-        info("[CONNECT] Envoi réussie.");
-        return true;
-    } while(retry++ < 1);
 
-    info("[CONNECT] Échec de l'envoi.");
-    return false;
-}
+    uint32_t id = this->radio().submitInit(
+        this->getId(), 
+        ID_CHAUDIERE, 
+        this->getIdAssociation(),
+        this->incrementIdMessage(),
+        0x01, 
+        0xA0FC,
+        0x0001,
+        0xA0FC,
+        0x0001,
+        (byte*)&payload,
+        sizeof(payload),
+        [this](int16_t err, const byte* donnees, size_t length) {
+            if(err != RADIOLIB_ERR_NONE) {
+                info("[CONNECT] Échec de l'envoi.");
+                return;
+            }
+            info("[CONNECT] Envoi réussie.");
+            mqtt().publishState(_mqttEntities.modeECS, getNomModeECS());
+        },
+        DutyCycle::PRIORITE::UTILISATEUR
+    );
 
-bool Connect::handlePassiveReadResponse(uint16_t adresseMemoire, const byte* buff, size_t length) {
-    const uint16_t addrInformations = 0x79E0;
-    const uint16_t addrConsommation = 0x7A18;
-    const uint16_t addrDate = 0xA02B;
-    const uint16_t addrModeEcs = 0xA0FC;
+    return id != 0;
+}
 
-    auto addrIsInformations = adresseMemoire == addrInformations || adresseMemoire == (addrInformations + 0x00C8);
-    auto addrIsConsommation = adresseMemoire == addrConsommation || adresseMemoire == (addrConsommation + 0x00C8);
-    auto addrIsDate = adresseMemoire == addrDate;
+bool Connect::handleReadResponse(uint16_t adresseMemoire, const byte* buff, size_t length) {
+    auto addrIsInformations = adresseMemoire == SchemaInformations::adresse || adresseMemoire == (SchemaInformations::adresse + 0x00C8);
+    auto addrIsConsommation = adresseMemoire == SchemaConsommation::adresse || adresseMemoire == (SchemaConsommation::adresse + 0x00C8);
+    auto addrIsDate = adresseMemoire == SchemaDate::adresse;
 
     if (addrIsInformations) {
         debug("[CONNECT] Réception des informations passives du Connect.");
-        struct {
-            FrisquetRadio::RadioTrameHeader header;
-            uint8_t longueurDonnees;
-            temperature16 temperatureECS;
-            temperature16 temperatureCDC;
-            temperature16 temperatureDepartZ1;
-            temperature16 temperatureDepartZ2;
-            temperature16 temperatureDepartZ3;
-            temperature16 temperatureInconnue1;
-            temperature16 temperatureInconnue2;
-            temperature16 temperatureInconnue3;
-            temperature16 temperatureInconnue4;
-            temperature16 temperatureInconnue5;
-            pression16 pression;
-            byte i1[1] = {0};
-            byte modeECS;
-            temperature16 temperatureECSInstant;
-            byte i2[10] = {0};
-            temperature16 temperatureAmbianteZ1;
-            temperature16 temperatureAmbianteZ2;
-            temperature16 temperatureAmbianteZ3;
-            byte i3[6] = {0};
-            temperature16 temperatureConsigneZ1;
-            temperature16 temperatureConsigneZ2;
-            temperature16 temperatureConsigneZ3;
-            temperature16 temperatureExterieure;
-        } resp;
-
-        if (length < sizeof(resp)) {
+        const SchemaInformations* resp = vueTrame<SchemaInformations>(buff, length);
+        if (!resp) {
             return false;
         }
-        memcpy(&resp, buff, sizeof(resp));
+
+        // Valeurs en mouvement (brûleur en marche, montée du CDC, pression) : relevés plus rapprochés
+        bool variation = fabsf(resp->temperatureCDC.toFloat() - getTemperatureCDC()) >= kVariationTemperature ||
+                         fabsf(resp->temperatureDepartZ1.toFloat() - getZone1().getTemperatureDepart()) >= kVariationTemperature ||
+                         fabsf(resp->temperatureECS.toFloat() - getTemperatureECS()) >= kVariationTemperature ||
+                         fabsf(resp->pression.toFloat() - getPression()) >= kVariationPression;
+        radio().lectures().signalerVariation(_besoinInformations, variation);
 
         if (getZone1().getSource() == Zone::SOURCE::CONNECT) {
-            getZone1().setTemperatureAmbiante(resp.temperatureAmbianteZ1.toFloat());
-            getZone1().setTemperatureConsigne(resp.temperatureConsigneZ1.toFloat());
+            getZone1().setTemperatureAmbiante(resp->temperatureAmbianteZ1.toFloat());
+            getZone1().setTemperatureConsigne(resp->temperatureConsigneZ1.toFloat());
         }
-        getZone1().setTemperatureDepart(resp.temperatureDepartZ1.toFloat());
+        getZone1().setTemperatureDepart(resp->temperatureDepartZ1.toFloat());
 
         if (getZone2().getSource() == Zone::SOURCE::CONNECT) {
-            getZone2().setTemperatureAmbiante(resp.temperatureAmbianteZ2.toFloat());
-            getZone2().setTemperatureConsigne(resp.temperatureConsigneZ2.toFloat());
+            getZone2().setTemperatureAmbiante(resp->temperatureAmbianteZ2.toFloat());
+            getZone2().setTemperatureConsigne(resp->temperatureConsigneZ2.toFloat());
         }
-        getZone2().setTemperatureDepart(resp.temperatureDepartZ2.toFloat());
+        getZone2().setTemperatureDepart(resp->temperatureDepartZ2.toFloat());
 
         if (getZone3().getSource() == Zone::SOURCE::CONNECT) {
-            getZone3().setTemperatureAmbiante(resp.temperatureAmbianteZ3.toFloat());
-            getZone3().setTemperatureConsigne(resp.temperatureConsigneZ3.toFloat());
+            getZone3().setTemperatureAmbiante(resp->temperatureAmbianteZ3.toFloat());
+            getZone3().setTemperatureConsigne(resp->temperatureConsigneZ3.toFloat());
         }
-        getZone3().setTemperatureDepart(resp.temperatureDepartZ3.toFloat());
-
-        setTemperatureExterieure(resp.temperatureExterieure.toFloat());
-        setTemperatureECS(resp.temperatureECS.toFloat());
-        setTemperatureCDC(resp.temperatureCDC.toFloat());
-        setPression(resp.pression.toFloat());
-
-        _lastRecuperationTemperatures = millis();
-        publishMqtt();
-        _zone1.publishMqtt();
-        _zone2.publishMqtt();
-        _zone3.publishMqtt();
+        getZone3().setTemperatureDepart(resp->temperatureDepartZ3.toFloat());
+
+        setTemperatureExterieure(resp->temperatureExterieure.toFloat());
+        setTemperatureECS(resp->temperatureECS.toFloat());
+        setTemperatureCDC(resp->temperatureCDC.toFloat());
+        setPression(resp->pression.toFloat());
+
+        radio().travaux().differer([this]() {
+            publishMqtt();
+            _zone1.publishMqtt();
+            _zone2.publishMqtt();
+            _zone3.publishMqtt();
+        });
         return true;
     }
 
     if (addrIsConsommation) {
         debug("[CONNECT] Réception des consommations passives du Connect.");
-        struct {
-            FrisquetRadio::RadioTrameHeader header;
-            uint8_t longueurDonnees;
-            byte i1[18] = {0};
-            fword consommationECS;
-            fword consommationChauffage;
-            byte i2[34] = {0};
-        } resp;
-
-        if (length < sizeof(resp)) {
+        const SchemaConsommation* resp = vueTrame<SchemaConsommation>(buff, length);
+        if (!resp) {
             return false;
         }
-        memcpy(&resp, buff, sizeof(resp));
 
-        setConsommationChauffage(resp.consommationChauffage.toInt16());
-        setConsommationECS(resp.consommationECS.toInt16());
-        _lastRecuperationConsommation = millis();
-        publishMqtt();
+        bool variation = resp->consommationChauffage.toInt16() != getConsommationChauffage() || resp->consommationECS.toInt16() != getConsommationECS();
+        radio().lectures().signalerVariation(_besoinConsommation, variation);
+
+        setConsommationChauffage(resp->consommationChauffage.toInt16());
+        setConsommationECS(resp->consommationECS.toInt16());
+        radio().travaux().differer([this]() { publishMqtt(); });
         return true;
     }
 
     if(addrIsDate) {
         debug("[CONNECT] Réception de la date passive du Connect.");
-        struct {
-            FrisquetRadio::RadioTrameHeader header;
-            uint8_t longueurDonnees;
-            byte date[6] = {0};
-            byte i1 = 0;
-            byte i2 = 0;
-        } resp;
-
-        if (length < sizeof(resp)) {
+        const SchemaDate* resp = vueTrame<SchemaDate>(buff, length);
+        if (!resp) {
             return false;
         }
-        memcpy(&resp, buff, sizeof(resp));
 
-        Date date = resp.date;
-        setDate(date);
+        setDate(Date(resp->date));
         return true;
     }
 
-    if (adresseMemoire == addrModeEcs) {
-        struct {
-            FrisquetRadio::RadioTrameHeader header;
-            uint8_t longueurDonnees;
-            byte i1;
-            byte modeECS;
-        } resp;
-
-        if (length < sizeof(resp)) {
+    if (adresseMemoire == SchemaModeECS::adresse) {
+        const SchemaModeECS* resp = vueTrame<SchemaModeECS>(buff, length);
+        if (!resp) {
             return false;
         }
-        memcpy(&resp, buff, sizeof(resp));
 
-        uint8_t raw = resp.modeECS;
+        uint8_t raw = resp->modeECS;
         uint8_t masked = raw & 0x7F;
-        info("[CONNECT] modeECS reçu brut=0x%02X, masqué=0x%02X", raw, masked);
         setModeECS((MODE_ECS)masked);
-        _lastRecuperationModeECS = millis();
-        publishMqtt();
+        radio().travaux().differer([this, raw, masked]() {
+            info("[CONNECT] modeECS reçu brut=0x%02X, masqué=0x%02X", raw, masked);
+            publishMqtt();
+        });
         return true;
     }
 
@@ -598,26 +402,26 @@ bool Connect::onReceive(byte* donnees, size_t length) {
             FrisquetRadio::RadioTrameAsk requete;
             readBuffer.getBytes((byte*)&requete, sizeof(requete));
 
-            size_t lengthRx = 0;
-            byte buffRx[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-            int16_t err = radio().receiveExpected(
+            // Réponse de la chaudière traitée à sa réception, sans bloquer la boucle
+            uint16_t adresse = requete.adresseMemoire.toUInt16();
+            uint16_t taille = requete.tailleMemoire.toUInt16();
+            return radio().interceptions().armer(
                 ID_CHAUDIERE,
                 getId(),
-                header.idAssociation,
                 header.idMessage,
                 header.idReception | 0x80,
                 header.type,
-                buffRx,
-                lengthRx,
-                15,
-                false
+                radio().horodatageReception(),
+                [this, adresse, taille](int16_t err, const byte* donnees, size_t length) {
+                    if (err != RADIOLIB_ERR_NONE) {
+                        return;
+                    }
+
+                    debug("[CONNECT] Réception réponse passive lecture adresse 0x%04X", adresse);
+                    radio().memoire().enregistrerReponse(adresse, taille, donnees, length, BoilerMemoryMap::SOURCE::ECOUTE_PASSIVE);
+                    handleReadResponse(adresse, donnees, length);
+                }
             );
-            if (err != RADIOLIB_ERR_NONE) {
-                return false;
-            }
-
-            debug("[CONNECT] Réception réponse passive lecture adresse 0x%04X", requete.adresseMemoire.toUInt16());
-            return handlePassiveReadResponse(requete.adresseMemoire.toUInt16(), buffRx, lengthRx);
         }
         return false;
     }
@@ -628,8 +432,6 @@ bool Connect::onReceive(byte* donnees, size_t length) {
         readBuffer.getBytes((byte*)&requete, sizeof(requete));
 
         if(requete.adresseMemoireEcriture.toUInt16() == 0xA154 && requete.tailleMemoireEcriture.toUInt16() == 0x0018) { // Modification Zone
-            info("[CONNECT] Réception trame Zone (idExpediteur=%d idReception(raw)=%d)", header.idExpediteur, header.idReception);
-
             struct {
                 temperature8 temperatureConfort;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
                 temperature8 temperatureReduit;     // Début 5°C -> 0 = 50 = 5°C - MAX Confort
@@ -667,41 +469,37 @@ bool Connect::onReceive(byte* donnees, size_t length) {
                 getZone(zoneId).setTemperatureConfort(donneesZone.temperatureConfort.toFloat());
             }
 
-            //Sauvegarde de la conf de la zone en NVs
-            getZone(zoneId).saveConfig();
-            info("[CONNECT] Mise à jour zone %d (id %d), publication MQTT locale.", getZone(zoneId).getNumeroZone(), zoneId );
-            getZone(zoneId).publishMqtt();
+            // Sauvegarde NVS, journal et publication MQTT après l'accusé de réception
+            uint8_t idExpediteur = header.idExpediteur;
+            uint8_t idReception = header.idReception;
+            radio().travaux().differer([this, zoneId, idExpediteur, idReception, passive]() {
+                info("[CONNECT] Réception trame Zone (idExpediteur=%d idReception(raw)=%d)", idExpediteur, idReception);
+                getZone(zoneId).saveConfig();
+                info("[CONNECT] Mise à jour zone %d (id %d), publication MQTT locale.", getZone(zoneId).getNumeroZone(), zoneId);
+                getZone(zoneId).publishMqtt();
+                publishMqtt();
+                if (!passive) {
+                    debug("[CONNECT] Accusé de réception émis %d µs après la réception.", radio().accuses().dernierUs());
+                }
+            });
 
             if (passive) {
-                publishMqtt();
                 return true;
             }
 
-            uint8_t retry = 0;
-            int16_t err;
-            
-            info("[CONNECT] Envoi accusé de réception");
-
-            do {
-                err = radio().sendAnswer(
-                    header.idDestinataire, 
-                    header.idExpediteur, 
-                    header.idAssociation, 
-                    header.idMessage, 
-                    header.idReception, 
-                    header.type,
-                    (byte*)&donneesZone,
-                    sizeof(donneesZone)
-                );
-                if(err != RADIOLIB_ERR_NONE) {
-                    delay(100);
-                    continue;
-                }
-
-                publishMqtt();
-
-                return true;
-            } while (retry++ < 5);
+            // Réémissions en cas d'erreur faites par sendAnswer, sans pause : passé le délai
+            // de l'accusé, la chaudière répète sa trame, reconnue comme doublon
+            int16_t err = radio().sendAnswer(
+                header.idDestinataire, 
+                header.idExpediteur, 
+                header.idAssociation, 
+                header.idMessage, 
+                header.idReception, 
+                header.type,
+                (byte*)&donneesZone,
+                sizeof(donneesZone)
+            );
+            return err == RADIOLIB_ERR_NONE;
         }
     }
 
@@ -792,9 +590,7 @@ void Connect::begin() {
             return;
         }
         setModeECS(payload);
-        if(envoyerModeECS()) {
-            mqtt().publishState(_mqttEntities.modeECS, getNomModeECS());
-        }
+        envoyerModeECS();
     });
 
   // SENSOR: Pression
@@ -805,6 +601,10 @@ void Connect::begin() {
   _mqttEntities.pression.set("device_class", "pressure");  
   _mqttEntities.pression.set("unit_of_measurement", "bar");
   mqtt().registerEntity(*device, _mqttEntities.pression, true);
+
+  if(!getConfig().useConnectPassive()) {
+    declarerLectures();
+  }
 }
 
 void Connect::loop() {
@@ -814,51 +614,9 @@ void Connect::loop() {
         return;
     }
 
+    // Températures, consommations et mode ECS sont relevés par le planificateur de lectures
+    // (declarerLectures), les réponses arrivent via handleReadResponse.
     if(estAssocie()) {
-        if (now - _lastRecuperationTemperatures >= 300000 || _lastRecuperationTemperatures == 0) { // 5 minutes
-            info("[CONNECT] Récupération des températures...");
-            if(recupererInformations()) {
-                _lastRecuperationTemperatures = now;
-                publishMqtt();
-                _zone1.publishMqtt();
-                _zone2.publishMqtt();
-                _zone3.publishMqtt();
-            } else {
-                _lastRecuperationTemperatures = now <= 60000 ? 1 : now - 60000;
-                error("[CONNECT] Échec de la récupération des températures.");
-            }
-            delay(100);
-            /*info("[CONNECT] Récupération de la pression...");
-            if(recupererPression()) {
-                publishMqtt();
-            } else {
-                _lastRecuperationTemperatures = now <= 60000 ? 1 : now - 60000;
-                error("[CONNECT] Échec de la récupération des températures.");
-            }*/
-        }
-
-        if (now - _lastRecuperationConsommation >= 3600000 || _lastRecuperationConsommation == 0) { // 1 heure
-            info("[CONNECT] Récupération des consommations...");
-            if(recupererConsommation()) {
-                _lastRecuperationConsommation = now;
-                publishMqtt();
-            } else {
-                _lastRecuperationConsommation = now <= 60000 ? 1 : now - 60000;
-            }
-            delay(100);
-        }
-
-        if (now - _lastRecuperationModeECS >= 3600000 || _lastRecuperationModeECS == 0) { // 1 heure
-            info("[CONNECT] Récupération du mode ECS...");
-            if(recupererModeECS()) {
-                publishMqtt();
-            } else {
-                error("[CONNECT] Récupération impossible");
-            }
-            _lastRecuperationModeECS = now;
-            delay(100);
-        }
-
         if (now - _lastEnvoiZone >= 30000 || _lastEnvoiZone == 0) { // 30 secondes
             envoiZones();
         }
@@ -869,30 +627,15 @@ void Connect::envoiZones() {
     if(estAssocie()) {
         if(getConfig().useZone1() && getZone1().getSource() == Zone::SOURCE::CONNECT && _zone1.getLastChange() > _zone1.getLastEnvoi()) {
             info("[CONNECT] Envoi de la zone 1.");
-            if(envoyerZone(_zone1)) {
-                info("[CONNECT] Envoi réussi !");
-                _zone1.publishMqtt();
-                _zone1.refreshLastEnvoi();
-                _envoiZ1 = false;
-            }
+            envoyerZone(_zone1);
         }
         if(getConfig().useZone2() && getZone2().getSource() == Zone::SOURCE::CONNECT && _zone2.getLastChange() > _zone2.getLastEnvoi()) {
             info("[CONNECT] Envoi de la zone 2 (id=%d numero=%d).", _zone2.getIdZone(), _zone2.getNumeroZone());
-            if(envoyerZone(_zone2)) {
-                info("[CONNECT] Envoi réussi !");
-                _zone2.publishMqtt();
-                _zone2.refreshLastEnvoi();
-                _envoiZ2 = false;
-            }
+            envoyerZone(_zone2);
         }
         if(getConfig().useZone3() && getZone3().getSource() == Zone::SOURCE::CONNECT && _zone3.getLastChange() > _zone3.getLastEnvoi()) {
             info("[CONNECT] Envoi de la zone 3 (id=%d numero=%d).", _zone3.getIdZone(), _zone3.getNumeroZone());
-            if(envoyerZone(_zone3)) {
-                info("[CONNECT] Envoi réussi !");
-                _zone3.publishMqtt();
-                _zone3.refreshLastEnvoi();
-                _envoiZ3 = false;
-            }
+            envoyerZone(_zone3);
         }
         _lastEnvoiZone = millis();
     }
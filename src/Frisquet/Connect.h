@@ -60,7 +60,7 @@ class Connect : public FrisquetDevice {
         bool setModeECS(const String& modeECS);
         String getNomModeECS();
 
-        bool onReceive(byte* donnees, size_t length);
+        bool onReceive(byte* donnees, size_t length) override;
 
         void publishMqtt();
     private:
@@ -88,17 +88,17 @@ class Connect : public FrisquetDevice {
 
         void setPression(float pression);
         float getPression();
-        bool handlePassiveReadResponse(uint16_t adresseMemoire, const byte* buff, size_t length);
+        bool handleReadResponse(uint16_t adresseMemoire, const byte* buff, size_t length);
+        void declarerLectures();
 
-        void envoiZones();
+        static constexpr float kVariationTemperature = 1.0f;    // °C entre deux relevés
+        static constexpr float kVariationPression = 0.1f;       // bar entre deux relevés
 
-        bool _envoiZ1 = false;
-        bool _envoiZ2 = false;
-        bool _envoiZ3 = false;
+        void envoiZones();
 
-        uint32_t _lastRecuperationTemperatures = 0;
-        uint32_t _lastRecuperationModeECS = 0;
-        uint32_t _lastRecuperationConsommation = 0;
+        uint8_t _besoinInformations = ReadPlanner::kAucun;
+        uint8_t _besoinConsommation = ReadPlanner::kAucun;
+        uint8_t _besoinModeECS = ReadPlanner::kAucun;
         uint32_t _lastEnvoiZone = 0;
 
         // MQTT
@@ -0,0 +1,49 @@
+#include "DeferredQueue.h"
+
+DeferredQueue::Entree* DeferredQueue::reserver() {
+    if(_nombre >= kCapacite) {
+        return nullptr;
+    }
+
+    Entree* entree = &_entrees[(_tete + _nombre) % kCapacite];
+    ++_nombre;
+    if(_nombre > _stats.profondeurMax) {
+        _stats.profondeurMax = _nombre;
+    }
+    return entree;
+}
+
+void DeferredQueue::differer(Travail travail) {
+    Entree* entree = reserver();
+    if(!entree) {
+        ++_stats.immediats;
+        travail();
+        return;
+    }
+
+    ++_stats.differes;
+    entree->travail = std::move(travail);
+}
+
+void DeferredQueue::vider() {
+    if(_nombre == 0) {
+        return;
+    }
+
+    uint32_t debut = micros();
+    while(_nombre > 0) {
+        Entree& entree = _entrees[_tete];
+        _tete = (_tete + 1) % kCapacite;
+        --_nombre;
+
+        // L'emplacement est libéré avant l'exécution : le travail peut en différer un autre
+        Travail travail = std::move(entree.travail);
+        entree.travail = nullptr;
+        travail();
+    }
+
+    uint32_t duree = micros() - debut;
+    if(duree > _stats.vidageMaxUs) {
+        _stats.vidageMaxUs = duree;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <heltec.h>
+#include <functional>
+
+// Travaux différés du chemin de réception : le traitement d'une trame se limite au
+// protocole (décodage, accusé, mise à jour d'état) ; journalisation, écritures NVS et
+// publications MQTT sont mises en file et exécutées une fois la radio revenue en
+// réception, dans l'ordre où elles ont été demandées. Les trames elles-mêmes sont
+// copiées dans RadioFrameLog, sans passer par cette file.
+class DeferredQueue {
+    public:
+        typedef std::function<void()> Travail;
+
+        static constexpr size_t kCapacite = 16;
+
+        struct Stats {
+            uint32_t differes = 0;
+            uint32_t immediats = 0;         // File pleine : travail exécuté sur le chemin rapide
+            uint32_t profondeurMax = 0;
+            uint32_t vidageMaxUs = 0;
+        };
+
+        // Exécuté au prochain vidage, immédiatement si la file est pleine
+        void differer(Travail travail);
+
+        // Exécute les travaux en attente, y compris ceux qu'ils ajoutent
+        void vider();
+
+        size_t enAttente() const { return _nombre; }
+        const Stats& stats() const { return _stats; }
+
+    private:
+        struct Entree {
+            Travail travail;
+        };
+
+        Entree* reserver();
+
+        Entree _entrees[kCapacite];
+        size_t _tete = 0;
+        size_t _nombre = 0;
+        Stats _stats;
+};
@@ -0,0 +1,61 @@
+#include "DutyCycle.h"
+
+// Part du budget au-delà de laquelle chaque priorité est retenue (en %)
+static const uint8_t kSeuils[] = {
+    0,      // ACCUSE : jamais retenu
+    100,    // UTILISATEUR
+    75,     // PERIODIQUE
+    50,     // DEBUG
+};
+
+void DutyCycle::avancer(uint32_t now) {
+    uint32_t minute = now / kCreneauMs;
+    if(!_initialise) {
+        _minuteCourante = minute;
+        _initialise = true;
+        return;
+    }
+
+    // Créneaux écoulés depuis le dernier passage : remis à zéro
+    uint32_t ecart = minute - _minuteCourante;
+    if(ecart > kCreneaux) {
+        ecart = kCreneaux;
+    }
+    for(uint32_t i = 1; i <= ecart; i++) {
+        _creneaux[(_minuteCourante + i) % kCreneaux] = 0;
+    }
+    _minuteCourante = minute;
+}
+
+uint32_t DutyCycle::utiliseUs() {
+    avancer(millis());
+    uint32_t total = 0;
+    for(uint8_t i = 0; i < kCreneaux; i++) {
+        total += _creneaux[i];
+    }
+    return total;
+}
+
+bool DutyCycle::autoriser(PRIORITE priorite, uint32_t dureeUs) {
+    if(priorite == PRIORITE::ACCUSE) {
+        return true;
+    }
+    uint64_t plafond = (uint64_t)kBudgetUs * kSeuils[priorite] / 100;
+    return utiliseUs() + dureeUs <= plafond;
+}
+
+void DutyCycle::enregistrer(uint32_t dureeUs) {
+    avancer(millis());
+    _creneaux[_minuteCourante % kCreneaux] += dureeUs;
+    ++_stats.emissions;
+}
+
+const char* DutyCycle::nomPriorite(PRIORITE priorite) {
+    switch(priorite) {
+        case PRIORITE::ACCUSE: return "accusé";
+        case PRIORITE::UTILISATEUR: return "utilisateur";
+        case PRIORITE::PERIODIQUE: return "périodique";
+        case PRIORITE::DEBUG: return "debug";
+    }
+    return "?";
+}
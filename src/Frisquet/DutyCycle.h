@@ -0,0 +1,56 @@
+#pragma once
+
+#include <heltec.h>
+
+// Temps d'émission sur une heure glissante, rapporté à la limite de la sous-bande
+// 868,7-869,2 MHz (0,1 % soit 3,6 s par heure). Chaque émission est comptée ; les
+// demandes sont admises selon leur priorité et la part du budget déjà consommée.
+class DutyCycle {
+    public:
+        enum PRIORITE : uint8_t {
+            ACCUSE,         // Accusés de réception : imposés par le protocole, jamais retenus
+            UTILISATEUR,    // Commandes (consignes, modes, zones)
+            PERIODIQUE,     // Relevés périodiques
+            DEBUG           // Portail : émission brute, lecture/scan mémoire
+        };
+
+        static constexpr uint32_t kBudgetUs = 3600000;     // 0,1 % de 3600 s
+        static constexpr uint8_t kCreneaux = 60;           // Heure glissante découpée en minutes
+        static constexpr uint32_t kCreneauMs = 60000;
+        static constexpr uint32_t kDebitBps = 25000;       // Radio::init
+        static constexpr size_t kSurcoutOctets = 11;       // Préambule, synchro, longueur, CRC
+
+        // Code retourné à la place d'une émission refusée faute de budget
+        static constexpr int16_t kErrBudget = -1100;
+
+        struct Stats {
+            uint32_t emissions = 0;
+            uint32_t differees = 0;     // Demandes retenues au moins une fois
+            uint32_t delestees = 0;     // Demandes abandonnées faute de budget
+        };
+
+        static uint32_t dureeEmissionUs(size_t length) {
+            return (uint32_t)((length + kSurcoutOctets) * 8 * 1000000ULL / kDebitBps);
+        }
+
+        // true si une émission de cette priorité et de cette durée tient dans le budget
+        bool autoriser(PRIORITE priorite, uint32_t dureeUs);
+        void enregistrer(uint32_t dureeUs);
+
+        void compterDifferee() { ++_stats.differees; }
+        void compterDelestee() { ++_stats.delestees; }
+
+        uint32_t utiliseUs();
+        uint32_t restantUs() { uint32_t utilise = utiliseUs(); return utilise < kBudgetUs ? kBudgetUs - utilise : 0; }
+        const Stats& stats() const { return _stats; }
+
+        static const char* nomPriorite(PRIORITE priorite);
+
+    private:
+        void avancer(uint32_t now);
+
+        uint32_t _creneaux[kCreneaux] = {0};    // Temps d'émission de chaque minute, en µs
+        uint32_t _minuteCourante = 0;
+        bool _initialise = false;
+        Stats _stats;
+};
@@ -0,0 +1,80 @@
+#include "FrameDedup.h"
+
+uint32_t FrameDedup::empreinte(const byte* trame, size_t length) {
+    // FNV-1a sur la trame complète
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < length; i++) {
+        hash ^= trame[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+FrameDedup::Entree* FrameDedup::trouver(uint8_t idExpediteur, uint8_t idAssociation, uint8_t idMessage, uint8_t type, bool ack, uint32_t now) {
+    for(Entree& entree : _entrees) {
+        if(entree.valide && now - entree.horodatage <= kFenetreMs &&
+           entree.idExpediteur == idExpediteur && entree.idAssociation == idAssociation &&
+           entree.idMessage == idMessage && entree.type == type && entree.ack == ack) {
+            return &entree;
+        }
+    }
+    return nullptr;
+}
+
+bool FrameDedup::verifier(const byte* trame, size_t length, const byte*& accuse, size_t& accuseLength) {
+    accuse = nullptr;
+    accuseLength = 0;
+    if(length < sizeof(RadioTrameHeader)) {
+        return false;
+    }
+
+    RadioTrameHeader header;
+    memcpy(&header, trame, sizeof(header));
+    uint32_t now = millis();
+    uint32_t hash = empreinte(trame, length);
+    ++_stats.verifiees;
+
+    Entree* entree = trouver(header.idExpediteur, header.idAssociation, header.idMessage, header.type, header.isAck(), now);
+    if(entree && entree->empreinte == hash) {
+        ++_stats.doublons;
+        entree->horodatage = now;   // La fenêtre suit la dernière répétition
+        if(entree->accuseLength > 0) {
+            accuse = entree->accuse;
+            accuseLength = entree->accuseLength;
+        }
+        return true;
+    }
+
+    // Nouvelle trame (ou même identifiant avec un autre contenu) : elle remplace l'ancienne
+    if(!entree) {
+        entree = &_entrees[_prochaine];
+        _prochaine = (_prochaine + 1) % kCapacite;
+    }
+    entree->valide = true;
+    entree->idExpediteur = header.idExpediteur;
+    entree->idAssociation = header.idAssociation;
+    entree->idMessage = header.idMessage;
+    entree->type = header.type;
+    entree->ack = header.isAck();
+    entree->empreinte = hash;
+    entree->horodatage = now;
+    entree->accuseLength = 0;
+    return false;
+}
+
+void FrameDedup::memoriserAccuse(const byte* accuse, size_t length) {
+    if(length < sizeof(RadioTrameHeader) || length > kAccuseMax) {
+        return;
+    }
+
+    RadioTrameHeader header;
+    memcpy(&header, accuse, sizeof(header));
+
+    // La trame d'origine venait du destinataire de l'accusé
+    Entree* entree = trouver(header.idDestinataire, header.idAssociation, header.idMessage, header.type, false, millis());
+    if(!entree) {
+        return;
+    }
+    memcpy(entree->accuse, accuse, length);
+    entree->accuseLength = length;
+}
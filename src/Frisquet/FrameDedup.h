@@ -0,0 +1,52 @@
+#pragma once
+
+#include <heltec.h>
+#include "Trames.h"
+
+// Filtre des répétitions : les appareils Frisquet réémettent une trame tant qu'ils
+// n'ont pas reçu l'accusé. Une copie identique (expéditeur, association, message,
+// type, contenu) reçue dans la fenêtre est écartée avant le routage ; si un accusé
+// avait été émis pour l'original, il est renvoyé tel quel.
+class FrameDedup {
+    public:
+        static constexpr size_t kCapacite = 16;
+        static constexpr uint32_t kFenetreMs = 3000;
+        static constexpr size_t kAccuseMax = 64;        // Accusés plus longs : non mémorisés
+
+        struct Stats {
+            uint32_t verifiees = 0;
+            uint32_t doublons = 0;
+            uint32_t accusesRenvoyes = 0;
+        };
+
+        // true si la trame répète une trame déjà vue ; accuse/accuseLength désignent
+        // alors l'accusé à renvoyer (accuseLength à 0 si aucun)
+        bool verifier(const byte* trame, size_t length, const byte*& accuse, size_t& accuseLength);
+
+        // Accusé émis en réponse à une trame reçue (en-tête de l'accusé en tête de trame)
+        void memoriserAccuse(const byte* accuse, size_t length);
+
+        void compterAccuseRenvoye() { ++_stats.accusesRenvoyes; }
+        const Stats& stats() const { return _stats; }
+
+    private:
+        struct Entree {
+            bool valide = false;
+            uint8_t idExpediteur = 0;
+            uint8_t idAssociation = 0;
+            uint8_t idMessage = 0;
+            uint8_t type = 0;
+            bool ack = false;
+            uint32_t empreinte = 0;
+            uint32_t horodatage = 0;
+            uint8_t accuseLength = 0;
+            byte accuse[kAccuseMax];
+        };
+
+        static uint32_t empreinte(const byte* trame, size_t length);
+        Entree* trouver(uint8_t idExpediteur, uint8_t idAssociation, uint8_t idMessage, uint8_t type, bool ack, uint32_t now);
+
+        Entree _entrees[kCapacite];
+        size_t _prochaine = 0;
+        Stats _stats;
+};
@@ -1,5 +1,6 @@
 #include "FrisquetDevice.h"
 #include "../Buffer.h"
+#include "Schemas.h"
 
 bool FrisquetDevice::associer(NetworkID& networkId, uint8_t& idAssociation) {
 
@@ -28,7 +29,7 @@ bool FrisquetDevice::associer(NetworkID& networkId, uint8_t& idAssociation) {
             NetworkID networkID;
         } donnees;
 
-        logRadio(true, (byte*)buff, buffLength);
+        radio().trames().enregistrer(true, buff, buffLength, radio().getRSSI(), RadioFrameLog::RECUE);
 
         ReadBuffer readBuffer = ReadBuffer(buff, buffLength);
         readBuffer.getBytes((byte*)&donnees, sizeof(donnees));
@@ -48,13 +49,14 @@ bool FrisquetDevice::associer(NetworkID& networkId, uint8_t& idAssociation) {
             info("[DEVICE] Récupération du NetworkID : %s.", byteArrayToHexString((byte*)&donnees.networkID, sizeof(NetworkID)).c_str());
             info("[DEVICE] Récupération de l'association ID : %s.", byteArrayToHexString((byte*)&donnees.header.idAssociation, 1).c_str());
 
-            logRadio(false, (byte*)&confirmPayload, sizeof(confirmPayload));
-
             for(uint8_t i = 0; i < 5; i++) {
                 err = radio().transmit((byte*)&confirmPayload, sizeof(confirmPayload));
+                radio().trames().enregistrer(false, (byte*)&confirmPayload, sizeof(confirmPayload), NAN,
+                                             err == RADIOLIB_ERR_NONE ? RadioFrameLog::EMISE : RadioFrameLog::ECHEC);
                 if (err != RADIOLIB_ERR_NONE) {
                     continue;
                 }
+                radio().dutyCycle().enregistrer(DutyCycle::dureeEmissionUs(sizeof(confirmPayload))); // Accusé : décompté, jamais retenu
                 delay(30);
             }
 
@@ -69,45 +71,29 @@ bool FrisquetDevice::associer(NetworkID& networkId, uint8_t& idAssociation) {
     return false;
 }
 
-bool FrisquetDevice::recupererDate() {
+bool FrisquetDevice::lirePlanifie(uint8_t& besoin, const char* nom, uint16_t adresse, uint16_t taille, ReadPlanner::Callback callback) {
     if(! estAssocie()) {
         return false;
     }
 
-    struct {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueur;
-        byte date[6] = {0};
-    } donnees;
-    
-    size_t length;
-    int16_t err;
+    if(besoin == ReadPlanner::kAucun) {
+        besoin = radio().lectures().declarer(nom, *this, adresse, taille, 0, callback);
+    }
+    return radio().lectures().demander(besoin);
+}
 
-    uint8_t retry = 0;
-    do {
-        length = 0;
-        err = this->radio().sendAsk(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01,
-            0xA02B,
-            0x0003,
-            (byte*)&donnees,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE || length < sizeof(donnees)) {
-            delay(100);
-            continue;
+bool FrisquetDevice::recupererDate() {
+    // Lecture planifiée : servie par le cache ou fusionnée avec une zone voisine
+    return lirePlanifie(_besoinDate, "date", SchemaDate::adresse, SchemaDate::taille, [this](int16_t err, const byte* donnees, size_t length) {
+        const SchemaDate* reponse = err == RADIOLIB_ERR_NONE ? vueTrame<SchemaDate>(donnees, length) : nullptr;
+        if(!reponse) {
+            error("[DEVICE] Échec de la récupération de la date de 0x%02X (err %d).", getId(), err);
+            return;
         }
+        setDate(Date(reponse->date));
+    });
+}
 
-        Date date = donnees.date;
-        setDate(date);
-        
-        return true;
-    } while(retry++ < 10);
-
-    return false;
+bool FrisquetDevice::relevePret(uint32_t derniere, uint32_t periodeMs) {
+    return radio().trafic().relevePret(derniere, periodeMs, millis());
 }
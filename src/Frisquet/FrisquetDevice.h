@@ -8,12 +8,6 @@
 
 #include <TimeLib.h>
 
-#define ID_CHAUDIERE 0x80
-#define ID_ZONE_1 0x08
-#define ID_ZONE_2 0x09
-#define ID_ZONE_3 0x0A
-#define ID_SONDE_EXTERIEURE 0x20
-#define ID_CONNECT 0x7E
 
 class FrisquetDevice {
     public:
@@ -23,14 +17,19 @@ class FrisquetDevice {
         }
 
         Date& getDate() { return _date; }
-        void setDate(Date& date){ _date = date; setTime(_date.heure, _date.minute, _date.seconde, _date.jour, _date.mois, _date.annee); }
+        void setDate(const Date& date){ _date = date; setTime(_date.heure, _date.minute, _date.seconde, _date.jour, _date.mois, _date.annee); }
         bool recupererDate();
         
         void setIdAssociation(uint8_t idAssociation) { _idAssociation = idAssociation; };
         uint8_t getIdAssociation() { return _idAssociation; };
         bool associer(NetworkID& networkId, uint8_t& idAssociation);
 
+        // Trame reçue via la table de routage, false si elle n'est pas exploitée
+        virtual bool onReceive(byte* donnees, size_t length) { return false; }
+
     protected:
+        friend class ReadPlanner;   // Lectures émises avec l'identité de l'appareil
+
         FrisquetDevice(FrisquetRadio& radio, Config& cfg, MqttManager& mqtt, uint8_t idAppareil, uint8_t idAssociation = 0xFF) : _radio(radio), _mqtt(mqtt), _cfg(cfg), _idAppareil(idAppareil), _idAssociation(idAssociation) {}
         FrisquetRadio& getRadio() { return _radio; }
 
@@ -41,6 +40,12 @@ class FrisquetDevice {
         FrisquetRadio& radio() { return _radio; }
         MqttManager& mqtt() { return _mqtt; }
 
+        // Relevé périodique à échéance, placé hors du trafic attendu (TrafficLearner::relevePret)
+        bool relevePret(uint32_t derniere, uint32_t periodeMs);
+
+        // Lecture ponctuelle d'une zone par le planificateur, déclarée au premier appel
+        bool lirePlanifie(uint8_t& besoin, const char* nom, uint16_t adresse, uint16_t taille, ReadPlanner::Callback callback);
+
         Preferences& getPreferences() { return _preferences; }
         Config& getConfig() { return _cfg; }
 
@@ -61,6 +66,7 @@ class FrisquetDevice {
         uint8_t _idAssociation = 0xFF;
         uint8_t _idAppareil = 0x00;
         uint8_t _idMessage = 0;
+        uint8_t _besoinDate = ReadPlanner::kAucun;
 
         Date _date;
 };
\ No newline at end of file
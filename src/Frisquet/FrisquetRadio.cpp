@@ -1,11 +1,89 @@
 #include "FrisquetRadio.h"
 #include "../Buffer.h"
 #include "../Logs.h"
+#include <vector>
 
-bool FrisquetRadio::receivedFlag = false;
-bool FrisquetRadio::interruptReceive = false;
+volatile bool FrisquetRadio::receivedFlag = false;
+volatile bool FrisquetRadio::interruptReceive = false;
+volatile uint32_t FrisquetRadio::rxIrqCount = 0;
+volatile uint32_t FrisquetRadio::rxIrqTimestamp = 0;
+TaskHandle_t FrisquetRadio::rxTask = nullptr;
 
-int16_t FrisquetRadio::sendAsk(
+void IRAM_ATTR FrisquetRadio::onPacketReceived() {
+    if(interruptReceive) { // Émission en cours : IRQ de fin d'émission, pas de paquet reçu
+        return;
+    }
+    rxIrqTimestamp = micros();
+    rxIrqCount = rxIrqCount + 1;
+    receivedFlag = true;
+
+    if(rxTask != nullptr) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(rxTask, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void FrisquetRadio::beginReceive() {
+    onReceive(FrisquetRadio::onPacketReceived);
+    startReceive();
+}
+
+bool FrisquetRadio::pollReceive() {
+    service();
+    if(!receivedFlag) {
+        return false;
+    }
+    receivedFlag = false;
+
+    uint32_t irqCount = rxIrqCount;
+    uint32_t timestamp = rxIrqTimestamp;
+    if(irqCount - _rxHandled > 1) { // Paquets écrasés dans le FIFO du SX1262 avant lecture
+        _rxLost += irqCount - _rxHandled - 1;
+    }
+    _rxHandled = irqCount;
+
+    RadioFrame* frame = _rxQueue.reserve();
+    bool queued = frame != nullptr;
+    if(!queued) { // File pleine : la trame reste visible du moteur de transactions, puis est perdue
+        frame = &_rxScratch;
+    }
+
+    int16_t err = readData(frame->data, 0);
+    if(err != RADIOLIB_ERR_NONE) {
+        if(err == RADIOLIB_ERR_CRC_MISMATCH) { // Trame abîmée : ni journalisée ni comptée par les statistiques
+            ++_rxCrcErrors;
+        }
+        startReceive();
+        return false;
+    }
+
+    frame->length = getPacketLength();
+    frame->rssi = getRSSI();
+    frame->timestamp = timestamp;
+    startReceive();
+    _calibration.observer(*frame);
+    if(frame->length >= sizeof(RadioTrameHeader)) {
+        _liens.observerTrame(((const RadioTrameHeader*)frame->data)->idExpediteur, frame->rssi, millis());
+    }
+
+    frame->journal = _trames.enregistrer(true, frame->data, frame->length, frame->rssi, queued ? RadioFrameLog::RECUE : RadioFrameLog::PERDUE);
+
+    // Réponse à la transaction en cours : consommée directement par le moteur
+    if(_transactions.onFrame(*frame)) {
+        _trames.qualifier(frame->journal, RadioFrameLog::REPONSE);
+        return true;
+    }
+
+    if(!queued) {
+        return false;
+    }
+
+    _rxQueue.commit();
+    return true;
+}
+
+uint32_t FrisquetRadio::submitAsk(
     uint8_t idExpediteur, 
     uint8_t idDestinataire, 
     uint8_t idAssociation, 
@@ -13,51 +91,30 @@ int16_t FrisquetRadio::sendAsk(
     uint8_t idReception,
     fword adresseMemoire,
     fword tailleMemoire,
-    byte* donneesReception,
-    size_t& length,
-    uint8_t retry
+    RadioTransactionEngine::Callback callback,
+    uint8_t retry,
+    DutyCycle::PRIORITE priorite
 ) {
-    
-    struct {
-        RadioTrameHeader header;
-        RadioTrameAsk body;
-    } trame;
-
-    trame.header.idExpediteur = idExpediteur;
-    trame.header.idDestinataire = idDestinataire;
-    trame.header.idAssociation = idAssociation;
-    trame.header.idMessage = idMessage;
-    trame.header.idReception = idReception;
-    trame.header.type = FrisquetRadio::MessageType::READ;
-    trame.body.adresseMemoire = adresseMemoire;
-    trame.body.tailleMemoire = tailleMemoire;
-
-    byte payload[sizeof(trame)];
-    memcpy(payload, &trame, sizeof(payload));
-    
-    interruptReceive = true;
-    uint8_t attempts = retry;
-    int16_t err;
-    do {
-        delay(30);
-        logRadio(false, (byte*)payload, sizeof(payload));
-        err = this->transmit((byte*)&payload, sizeof(payload));
-        if(err != RADIOLIB_ERR_NONE) {
-            continue;
-        }
+    RadioTrameAsk body;
+    body.adresseMemoire = adresseMemoire;
+    body.tailleMemoire = tailleMemoire;
 
-        err = this->receiveExpected(idDestinataire, idExpediteur, idAssociation, idMessage, idReception|0x80, FrisquetRadio::MessageType::READ, donneesReception, length, retry);
-        if(err == RADIOLIB_ERR_NONE || err == RADIOLIB_ERR_ADDRESS_NOT_FOUND) {
-            break;
-        }
-    } while (--attempts > 0);
+    RadioTransactionEngine::Request request;
+    request.idExpediteur = idExpediteur;
+    request.idDestinataire = idDestinataire;
+    request.idAssociation = idAssociation;
+    request.idMessage = idMessage;
+    request.idReception = idReception;
+    request.type = FrisquetRadio::MessageType::READ;
+    request.body = (byte*)&body;
+    request.bodyLength = sizeof(body);
+    request.attempts = retry;
+    request.priorite = priorite;
 
-    interruptReceive = false;
-    startReceive();
-    return err;
+    return _transactions.submit(request, memoriser(request, callback));
 }
 
-int16_t FrisquetRadio::sendInit(
+uint32_t FrisquetRadio::submitInit(
     uint8_t idExpediteur, 
     uint8_t idDestinataire, 
     uint8_t idAssociation, 
@@ -69,51 +126,93 @@ int16_t FrisquetRadio::sendInit(
     fword tailleMemoireEcriture,
     byte* donneesEnvoi, 
     uint8_t longueurDonnees,
-    byte* donneesReception, 
-    size_t& length
+    RadioTransactionEngine::Callback callback,
+    DutyCycle::PRIORITE priorite
 ) {
+    RadioTrameInit init;
+    init.adresseMemoireLecture = adresseMemoireLecture;
+    init.tailleMemoireLecture = tailleMemoireLecture;
+    init.adresseMemoireEcriture = adresseMemoireEcriture;
+    init.tailleMemoireEcriture = tailleMemoireEcriture;
+    init.longueurDonneesEcriture = longueurDonnees;
 
-    struct {
-        RadioTrameHeader header;
-        RadioTrameInit body;
-    } trame;
-
-    trame.header.idExpediteur = idExpediteur;
-    trame.header.idDestinataire = idDestinataire;
-    trame.header.idAssociation = idAssociation;
-    trame.header.idMessage = idMessage;
-    trame.header.idReception = idReception;
-    trame.header.type = FrisquetRadio::MessageType::INIT;
-    trame.body.adresseMemoireLecture = adresseMemoireLecture;
-    trame.body.tailleMemoireLecture = tailleMemoireLecture;
-    trame.body.adresseMemoireEcriture = adresseMemoireEcriture;
-    trame.body.tailleMemoireEcriture = tailleMemoireEcriture;
-    trame.body.longueurDonneesEcriture = longueurDonnees;
-    
-    byte payload[sizeof(trame) + longueurDonnees];
-    memcpy(payload, &trame, sizeof(trame));
-    memcpy(&payload[sizeof(trame)], donneesEnvoi, longueurDonnees);
-
-    interruptReceive = true;
-    uint8_t retry = 0;
-    int16_t err;
-
-    do {
-        logRadio(false, (byte*)payload, sizeof(payload));
-        err = this->transmit(payload, sizeof(payload));
-        if(err != RADIOLIB_ERR_NONE) {
-            continue;
-        }
-        
-        err = this->receiveExpected(idDestinataire, idExpediteur, idAssociation, idMessage, idReception|0x80, FrisquetRadio::MessageType::INIT, donneesReception, length);
+    byte body[sizeof(init) + longueurDonnees];
+    memcpy(body, &init, sizeof(init));
+    memcpy(&body[sizeof(init)], donneesEnvoi, longueurDonnees);
+
+    RadioTransactionEngine::Request request;
+    request.idExpediteur = idExpediteur;
+    request.idDestinataire = idDestinataire;
+    request.idAssociation = idAssociation;
+    request.idMessage = idMessage;
+    request.idReception = idReception;
+    request.type = FrisquetRadio::MessageType::INIT;
+    request.body = body;
+    request.bodyLength = sizeof(body);
+    request.priorite = priorite;
+
+    return _transactions.submit(request, memoriser(request, callback));
+}
+
+RadioTransactionEngine::Callback FrisquetRadio::memoriser(const RadioTransactionEngine::Request& request, RadioTransactionEngine::Callback callback) {
+    // Zones lue et écrite relevées à la soumission : le corps de la requête ne survit pas à l'appel
+    uint16_t adresseLecture = 0;
+    uint16_t tailleLecture = 0;
+    uint16_t adresseEcriture = 0;
+    std::vector<byte> ecriture;
+
+    if(request.type == MessageType::READ && request.bodyLength >= sizeof(RadioTrameAsk)) {
+        const RadioTrameAsk* ask = (const RadioTrameAsk*)request.body;
+        adresseLecture = ask->adresseMemoire.toUInt16();
+        tailleLecture = ask->tailleMemoire.toUInt16();
+    } else if(request.type == MessageType::INIT && request.bodyLength >= sizeof(RadioTrameInit)) {
+        const RadioTrameInit* init = (const RadioTrameInit*)request.body;
+        adresseLecture = init->adresseMemoireLecture.toUInt16();
+        tailleLecture = init->tailleMemoireLecture.toUInt16();
+        adresseEcriture = init->adresseMemoireEcriture.toUInt16();
+
+        size_t longueur = request.bodyLength - sizeof(RadioTrameInit);
+        size_t maxEcriture = init->tailleMemoireEcriture.toUInt16() * 2;
+        const byte* donnees = request.body + sizeof(RadioTrameInit);
+        ecriture.assign(donnees, donnees + (longueur < maxEcriture ? longueur : maxEcriture));
+    } else {
+        return callback;
+    }
+
+    return [this, adresseLecture, tailleLecture, adresseEcriture, ecriture, callback](int16_t err, const byte* donnees, size_t length) {
         if(err == RADIOLIB_ERR_NONE) {
-            break;
+            // L'écho d'écriture d'abord : la zone relue par la chaudière fait foi
+            if(ecriture.size() >= 2) {
+                _memoire.enregistrer(adresseEcriture, ecriture.data(), ecriture.size() / 2, BoilerMemoryMap::SOURCE::ECHO_ECRITURE);
+            }
+            _memoire.enregistrerReponse(adresseLecture, tailleLecture, donnees, length, BoilerMemoryMap::SOURCE::LECTURE_ACTIVE);
+        }
+        if(callback) {
+            callback(err, donnees, length);
         }
-        delay(30);
-    } while (retry++ < 5);
+    };
+}
+
+int16_t FrisquetRadio::transmitFrame(byte* payload, size_t length, DutyCycle::PRIORITE priorite) {
+    uint32_t duree = DutyCycle::dureeEmissionUs(length);
+    if(!_dutyCycle.autoriser(priorite, duree)) {
+        _dutyCycle.compterDelestee();
+        _trames.enregistrer(false, payload, length, NAN, RadioFrameLog::DELESTEE);
+        error("[RADIO] Budget d'émission épuisé, trame %s non émise.", DutyCycle::nomPriorite(priorite));
+        return DutyCycle::kErrBudget;
+    }
 
+    _calibration.avantEmission();   // Calibration en cours : émission sur le réglage en vigueur
+    interruptReceive = true; // L'IRQ de fin d'émission partage la ligne DIO
+    int16_t err = this->transmit(payload, length);
+    _finEmissionUs = micros();
     interruptReceive = false;
     startReceive();
+    _trames.enregistrer(false, payload, length, NAN, err == RADIOLIB_ERR_NONE ? RadioFrameLog::EMISE : RadioFrameLog::ECHEC);
+
+    if(err == RADIOLIB_ERR_NONE) {
+        _dutyCycle.enregistrer(duree);
+    }
     return err;
 }
 
@@ -143,88 +242,65 @@ int16_t FrisquetRadio::sendAnswer(
     writeBuffer.putUInt8(longueurDonnees);
     writeBuffer.putBytes(donneesEnvoi, longueurDonnees);
 
-    interruptReceive = true;
-    uint8_t retry = 0;
-    int16_t err;
-    do {
-        delay(30);
-        logRadio(false, (byte*)payload, writeBuffer.getLength());
-        err = this->transmit(payload, writeBuffer.getLength());
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(10);
-            continue;
+    // Garde comptée depuis l'interruption de réception : le traitement de la trame en fait
+    // déjà partie, l'accusé part dès qu'elle est écoulée
+    if(_horodatageReception != 0) {
+        uint32_t ecouleUs = micros() - _horodatageReception;
+        if(ecouleUs < kGardeAccuseUs) {
+            delayMicroseconds(kGardeAccuseUs - ecouleUs);
         }
-        
-        break;
-    } while (retry++ < 5);
+    }
+
+    int16_t err = RADIOLIB_ERR_UNKNOWN;
+    for(uint8_t essai = 0; essai < kEssaisAccuse; essai++) {
+        err = this->transmitFrame(payload, writeBuffer.getLength(), DutyCycle::PRIORITE::ACCUSE);
+        if(err == RADIOLIB_ERR_NONE) {
+            _doublons.memoriserAccuse(payload, writeBuffer.getLength());
+            mesurerAccuse(payload);
+            break;
+        }
+        if(err == DutyCycle::kErrBudget) {     // Inutile d'insister, le budget ne se reconstitue pas si vite
+            break;
+        }
+    }
 
-    interruptReceive = false;
-    startReceive();
     return err;
 }
 
-int16_t FrisquetRadio::receiveExpected(
-    uint8_t idExpediteur, 
-    uint8_t idDestinataire, 
-    uint8_t idAssociation, 
-    uint8_t idMessage, 
-    uint8_t idReception,
-    uint8_t type,
-    byte* donnees, 
-    size_t& length,
-    uint8_t retry,
-    bool useReadData
-) {
-    interruptReceive = true;
-
-    byte buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-    int16_t err;
-    RadioTrameHeader radioTrameHeader;
+bool FrisquetRadio::filtrerDoublon(const byte* trame, size_t length) {
+    const byte* accuse;
+    size_t accuseLength;
+    if(!_doublons.verifier(trame, length, accuse, accuseLength)) {
+        return false;
+    }
 
-    do {
-        if(useReadData) {
-            err = this->readData(buff, 0);
-        } else {
-            err = this->receive(buff, 0);
+    if(accuseLength > 0) {
+        byte payload[FrameDedup::kAccuseMax];
+        memcpy(payload, accuse, accuseLength);
+        if(transmitFrame(payload, accuseLength, DutyCycle::PRIORITE::ACCUSE) == RADIOLIB_ERR_NONE) {
+            _doublons.compterAccuseRenvoye();
+            mesurerAccuse(payload);
         }
+    }
+    return true;
+}
 
-        if(err != RADIOLIB_ERR_NONE) {
-            continue;
-        }
+void FrisquetRadio::mesurerAccuse(const byte* accuse) {
+    if(_horodatageReception == 0) { // Émission hors du traitement d'une trame reçue
+        return;
+    }
 
-        size_t len = this->getPacketLength();
+    const RadioTrameHeader* header = (const RadioTrameHeader*)accuse;
+    if(!_accuses.enregistrer(header->type, _horodatageReception, _finEmissionUs)) {
+        return;
+    }
 
-        if(len < sizeof(radioTrameHeader)) {
-            continue;
-        }
-        
-        logRadio(true, (byte*)buff, len);
-
-        memcpy(&radioTrameHeader, buff, sizeof(radioTrameHeader));
-        if( radioTrameHeader.idExpediteur == idExpediteur && 
-            radioTrameHeader.idDestinataire == idDestinataire && 
-            radioTrameHeader.idMessage == idMessage &&
-            radioTrameHeader.idReception ==  idReception &&
-            radioTrameHeader.type ==  type
-        ) {
-            if(length == 0 || len < length) {
-                length = len;   
-            }
-            memcpy(donnees, buff, length);
-            break;
-        } else {
-            if(radioTrameHeader.type != type && radioTrameHeader.type == 0x83) {
-                err = RADIOLIB_ERR_ADDRESS_NOT_FOUND;
-                break;
-            }
-            err = RADIOLIB_ERR_RX_TIMEOUT;
-        }
-    } while (--retry > 0);
-
-
-    interruptReceive = false;
-    startReceive();
-    return err;
+    uint32_t delaiUs = _accuses.dernierUs();
+    uint32_t delaiMaxUs = _accuses.delaiMaxUs();
+    uint8_t idDestinataire = header->idDestinataire;
+    _travaux.differer([delaiUs, delaiMaxUs, idDestinataire]() {
+        error("[RADIO] Accusé vers 0x%02X émis en %d ms, délai maximal de %d ms dépassé.", idDestinataire, delaiUs / 1000, delaiMaxUs / 1000);
+    });
 }
 
 void FrisquetRadio::setNetworkID(NetworkID networkID) {
@@ -1,53 +1,50 @@
 #pragma once
-#include "../Radio.h"
+#include "../RadioTransport.h"
 #include "Utils.h"
 #include "NetworkID.h"
+#include "RadioFrameQueue.h"
+#include "RadioTransaction.h"
+#include "BoilerMemoryMap.h"
+#include "FrameDedup.h"
+#include "TrafficLearner.h"
+#include "ReplyInterceptor.h"
+#include "RadioCalibration.h"
+#include "LinkStats.h"
+#include "ReadPlanner.h"
+#include "DeferredQueue.h"
+#include "AckTurnaround.h"
+#include "RadioFrameLog.h"
 
-class FrisquetRadio : public Radio {
+// Protocole Frisquet au-dessus d'un transport radio (SX1262 ou canal simulé)
+class FrisquetRadio : public RadioTransport {
     public: 
+    explicit FrisquetRadio(RadioTransport& transport) : _transport(transport), _transactions(*this), _calibration(*this), _lectures(*this) {}
 
-    enum MessageType : byte {
-        READ = 0x03,
-        INIT = 0x17,
-        ASSOCIATION = 0x41
-    };
-    
-    struct RadioTrameHeader {
-        byte idDestinataire = 0x00;
-        byte idExpediteur = 0x00;
-        byte idAssociation = 0x00;
-        byte idMessage = 0x00;
-        byte idReception = 0x01; //0x01 => Si message direct, sinon id destinataire finale (exemple envoi au satellite Z1 via chaudière) + 0x80 si accusé réception
-        byte type = 0x00;
-
-        void answer(RadioTrameHeader& radioTrameHeader) {
-            radioTrameHeader.idExpediteur = idDestinataire;
-            radioTrameHeader.idDestinataire = idExpediteur;
-            radioTrameHeader.idAssociation = idAssociation;
-            radioTrameHeader.idMessage = idMessage;
-            radioTrameHeader.idReception = idReception | 0x80;
-            radioTrameHeader.type = type;
-        }
-
-        bool isAck() {
-            return idReception >= 0x80;
-        }
-    };
-
-    struct RadioTrameAsk {
-        fword adresseMemoire;
-        fword tailleMemoire;
-    };
-
-    struct RadioTrameInit {
-        fword adresseMemoireLecture;
-        fword tailleMemoireLecture;
-        fword adresseMemoireEcriture;
-        fword tailleMemoireEcriture;
-        uint8_t longueurDonneesEcriture;
-    };
-
-    int16_t sendAsk(
+    void init() override { _transport.init(); }
+    int16_t startReceive() override { return _transport.startReceive(); }
+    int16_t receive(uint8_t data[], size_t len) override { return _transport.receive(data, len); }
+    int16_t readData(uint8_t data[], size_t len) override { return _transport.readData(data, len); }
+    int16_t transmit(uint8_t data[], size_t len) override { return _transport.transmit(data, len); }
+    size_t getPacketLength() override { return _transport.getPacketLength(); }
+    float getRSSI() override { return _transport.getRSSI(); }
+    void onReceive(void (*func)()) override { _transport.onReceive(func); }
+    void setSyncWord(uint8_t* syncWord, size_t len) override { _transport.setSyncWord(syncWord, len); }
+    void service() override { _transport.service(); }
+    bool isChannelFree(float thresholdDbm) override { return _transport.isChannelFree(thresholdDbm); }
+    int16_t setChannel(float frequencyMHz, float rxBandwidthKHz) override { return _transport.setChannel(frequencyMHz, rxBandwidthKHz); }
+
+    // Bruit de fond ~-116 dBm à 156,2 kHz (bande nominale), ~-114 dBm à 234,3 kHz : au moins
+    // ~20 dB de marge quelle que soit la bande retenue par la calibration
+    static constexpr float kSeuilCanalLibreDbm = -95.0f;
+
+    typedef RadioMessageType MessageType;
+    typedef ::RadioTrameHeader RadioTrameHeader;
+    typedef ::RadioTrameAsk RadioTrameAsk;
+    typedef ::RadioTrameInit RadioTrameInit;
+
+    // Transactions non bloquantes : le rappel est déclenché depuis FrisquetManager::loop.
+    // Aucune attente bloquante sur la tâche radio : les files RX et les accusés restent servis.
+    uint32_t submitAsk(
         uint8_t idExpediteur, 
         uint8_t idDestinataire, 
         uint8_t idAssociation, 
@@ -55,12 +52,12 @@ class FrisquetRadio : public Radio {
         uint8_t idReception,
         fword adresseMemoire,
         fword tailleMemoire,
-        byte* donneesReception,
-        size_t& length,
-        uint8_t retry = 5
+        RadioTransactionEngine::Callback callback,
+        uint8_t retry = RadioTransactionEngine::kDefaultAttempts,
+        DutyCycle::PRIORITE priorite = DutyCycle::PRIORITE::PERIODIQUE
     );
 
-    int16_t sendInit(
+    uint32_t submitInit(
         uint8_t idExpediteur, 
         uint8_t idDestinataire, 
         uint8_t idAssociation, 
@@ -72,10 +69,17 @@ class FrisquetRadio : public Radio {
         fword tailleMemoireEcriture,
         byte* donneesEnvoi, 
         uint8_t longueurDonnees,
-        byte* donneesReception, 
-        size_t& length
+        RadioTransactionEngine::Callback callback,
+        DutyCycle::PRIORITE priorite = DutyCycle::PRIORITE::PERIODIQUE
     );
 
+    // Accusé de réception d'une trame reçue, émis au plus tôt kGardeAccuseUs après son
+    // interruption DIO : l'expéditeur doit avoir fini sa trame et basculé son module en
+    // réception (quelques centaines de µs sur les émetteurs-récepteurs sub-GHz), marge comprise.
+    // Une erreur d'émission (SPI, délai du SX1262) est réessayée aussitôt, kEssaisAccuse fois au plus.
+    static constexpr uint32_t kGardeAccuseUs = 3000;
+    static constexpr uint8_t kEssaisAccuse = 3;
+
     int16_t sendAnswer(
         uint8_t idExpediteur, 
         uint8_t idDestinataire, 
@@ -87,21 +91,91 @@ class FrisquetRadio : public Radio {
         uint8_t longueurDonnees
     );
     
-    int16_t receiveExpected(
-            uint8_t idExpediteur, 
-            uint8_t idDestinataire, 
-            uint8_t idAssociation, 
-            uint8_t idMessage, 
-            uint8_t idReception, 
-            uint8_t type,
-            byte* donnees, 
-            size_t& length,
-            uint8_t retry = 5,
-            bool useReadData = false
-        );
-
     void setNetworkID(NetworkID networkID);
 
-    static bool receivedFlag;
-    static bool interruptReceive;
+    // Émission d'une trame complète puis retour en réception ; chaque émission est
+    // décomptée du budget d'émission, DutyCycle::kErrBudget si la priorité ne le permet plus
+    int16_t transmitFrame(byte* payload, size_t length, DutyCycle::PRIORITE priorite);
+    DutyCycle& dutyCycle() { return _dutyCycle; }
+    RadioTransactionEngine& transactions() { return _transactions; }
+
+    // Mémoire chaudière alimentée par chaque lecture/écriture acquittée
+    BoilerMemoryMap& memoire() { return _memoire; }
+
+    // Répétitions d'une trame déjà traitée : true si elle doit être ignorée,
+    // l'accusé émis pour l'original est alors renvoyé
+    bool filtrerDoublon(const byte* trame, size_t length);
+    FrameDedup& doublons() { return _doublons; }
+
+    // Rythme d'émission des autres appareils, appris des trames reçues
+    TrafficLearner& trafic() { return _trafic; }
+
+    // Réponses de la chaudière aux appareils physiques, attendues sans bloquer
+    ReplyInterceptor& interceptions() { return _interceptions; }
+
+    // Horodatage (interruption DIO) de la trame en cours de traitement
+    uint32_t horodatageReception() const { return _horodatageReception; }
+    void setHorodatageReception(uint32_t timestamp) { _horodatageReception = timestamp; }
+
+    // Écart de fréquence et bande passante, balayés sur le trafic reçu
+    RadioCalibration& calibration() { return _calibration; }
+
+    // Qualité de liaison par appareil distant (RSSI, aller-retour, issue des transactions)
+    LinkStats& liens() { return _liens; }
+
+    // Lectures mémoire déclarées par les appareils, fusionnées en un minimum de transactions
+    ReadPlanner& lectures() { return _lectures; }
+
+    // Journalisation, NVS et MQTT reportés après le retour en réception (FrisquetManager::loop)
+    DeferredQueue& travaux() { return _travaux; }
+
+    // Délai entre l'interruption de réception et la fin d'émission des accusés, par type de message
+    AckTurnaround& accuses() { return _accuses; }
+
+    // Trames brutes émises et reçues, avec leur issue, mises en forme à la lecture
+    RadioFrameLog& trames() { return _trames; }
+
+    // Réception asynchrone : l'interruption DIO horodate le paquet,
+    // pollReceive() le transfère du SX1262 vers la file RX.
+    void beginReceive();
+    bool pollReceive();
+    RadioFrameQueue& rxQueue() { return _rxQueue; }
+
+    uint32_t getRxIrqCount() { return rxIrqCount; }
+    uint32_t getRxLostCount() { return _rxLost; }
+    uint32_t getRxCrcErrorCount() { return _rxCrcErrors; }
+
+    static void IRAM_ATTR onPacketReceived();
+
+    static volatile bool receivedFlag;
+    static volatile bool interruptReceive;
+    static volatile uint32_t rxIrqCount;
+    static volatile uint32_t rxIrqTimestamp;
+    static TaskHandle_t rxTask;     // Tâche réveillée à chaque paquet reçu
+
+    private:
+        RadioTransport& _transport;
+
+        RadioTransactionEngine::Callback memoriser(const RadioTransactionEngine::Request& request, RadioTransactionEngine::Callback callback);
+        void mesurerAccuse(const byte* accuse);
+
+        RadioFrameQueue _rxQueue;
+        RadioFrame _rxScratch;
+        RadioTransactionEngine _transactions;
+        BoilerMemoryMap _memoire;
+        FrameDedup _doublons;
+        DutyCycle _dutyCycle;
+        TrafficLearner _trafic;
+        ReplyInterceptor _interceptions;
+        uint32_t _horodatageReception = 0;
+        RadioCalibration _calibration;
+        LinkStats _liens;
+        ReadPlanner _lectures;
+        DeferredQueue _travaux;
+        AckTurnaround _accuses;
+        RadioFrameLog _trames;
+        uint32_t _finEmissionUs = 0;    // micros() à la fin de la dernière émission
+        uint32_t _rxHandled = 0;
+        uint32_t _rxLost = 0;
+        uint32_t _rxCrcErrors = 0;
 };
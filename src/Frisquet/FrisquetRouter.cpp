@@ -0,0 +1,69 @@
+#include "FrisquetRouter.h"
+#include "../Logs.h"
+
+// Combinaisons de jokers de la plus précise à la plus large :
+// bit 0 = type, bit 1 = expéditeur, bit 2 = destinataire
+static const uint8_t kOrdreJokers[] = { 0b000, 0b001, 0b010, 0b100, 0b011, 0b101, 0b110, 0b111 };
+
+void FrisquetRouter::ajouter(const char* nom, FrisquetDevice& device, uint16_t idDestinataire, uint16_t idExpediteur, uint16_t type) {
+    uint32_t k = cle(idDestinataire, idExpediteur, type);
+    if(_index.find(k) != _index.end()) {
+        error("[ROUTEUR] Route %s ignorée, déjà couverte par %s.", nom, _routes[_index[k]].nom);
+        return;
+    }
+
+    Route route;
+    route.nom = nom;
+    route.device = &device;
+    route.idDestinataire = idDestinataire;
+    route.idExpediteur = idExpediteur;
+    route.type = type;
+
+    _index[k] = (uint8_t)_routes.size();
+    _routes.push_back(route);
+    _jokers |= 1 << ((type == kTous ? 0b001 : 0) | (idExpediteur == kTous ? 0b010 : 0) | (idDestinataire == kTous ? 0b100 : 0));
+}
+
+void FrisquetRouter::vider() {
+    _routes.clear();
+    _index.clear();
+    _jokers = 0;
+}
+
+FrisquetRouter::Route* FrisquetRouter::trouver(const RadioTrameHeader& header) {
+    for(uint8_t joker : kOrdreJokers) {
+        if(!(_jokers & (1 << joker))) {
+            continue;
+        }
+
+        auto it = _index.find(cle(
+            joker & 0b100 ? kTous : header.idDestinataire,
+            joker & 0b010 ? kTous : header.idExpediteur,
+            joker & 0b001 ? kTous : header.type
+        ));
+        if(it != _index.end()) {
+            return &_routes[it->second];
+        }
+    }
+    return nullptr;
+}
+
+bool FrisquetRouter::router(byte* donnees, size_t length) {
+    if(length < sizeof(RadioTrameHeader)) {
+        ++_nonRoutees;
+        return false;
+    }
+
+    Route* route = trouver(*(const RadioTrameHeader*)donnees);
+    if(!route) {
+        ++_nonRoutees;
+        return false;
+    }
+
+    ++route->hits;
+    if(!route->device->onReceive(donnees, length)) {
+        ++route->drops;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <heltec.h>
+#include <unordered_map>
+#include <vector>
+#include "FrisquetDevice.h"
+
+// Table de routage des trames reçues, construite une fois au démarrage :
+// (idDestinataire, idExpediteur, type) -> appareil émulé. Chaque champ accepte
+// un joker ; la route la plus précise l'emporte, puis la première enregistrée.
+class FrisquetRouter {
+    public:
+        static constexpr uint16_t kTous = 0x100;    // Joker : n'importe quelle valeur du champ
+
+        struct Route {
+            const char* nom;
+            FrisquetDevice* device;
+            uint16_t idDestinataire;
+            uint16_t idExpediteur;
+            uint16_t type;
+            uint32_t hits = 0;      // Trames transmises à l'appareil
+            uint32_t drops = 0;     // Trames refusées par l'appareil
+        };
+
+        void ajouter(const char* nom, FrisquetDevice& device, uint16_t idDestinataire, uint16_t idExpediteur, uint16_t type = kTous);
+        void vider();
+
+        Route* trouver(const RadioTrameHeader& header);
+
+        // Transmet la trame à l'appareil routé, false si aucune route ou trame refusée
+        bool router(byte* donnees, size_t length);
+
+        const std::vector<Route>& routes() const { return _routes; }
+        uint32_t getNonRoutees() const { return _nonRoutees; }
+
+    private:
+        static uint32_t cle(uint16_t idDestinataire, uint16_t idExpediteur, uint16_t type) {
+            return (uint32_t)idDestinataire << 18 | (uint32_t)idExpediteur << 9 | type;
+        }
+
+        std::vector<Route> _routes;
+        std::unordered_map<uint32_t, uint8_t> _index;  // Clé -> position dans _routes
+        uint8_t _jokers = 0;                            // Combinaisons de jokers présentes dans la table
+        uint32_t _nonRoutees = 0;
+};
@@ -0,0 +1,78 @@
+#include "LinkStats.h"
+#include "../RadioTransport.h"
+#include "DutyCycle.h"
+
+LinkStats::Pair* LinkStats::trouver(uint8_t id, uint32_t now) {
+    Pair* libre = nullptr;
+    Pair* plusAncien = &_pairs[0];
+    for(Pair& pair : _pairs) {
+        if(pair.actif && pair.id == id) {
+            return &pair;
+        }
+        if(!pair.actif && !libre) {
+            libre = &pair;
+        }
+        if(now - pair.derniereActivite > now - plusAncien->derniereActivite) {
+            plusAncien = &pair;
+        }
+    }
+
+    Pair* pair = libre ? libre : plusAncien;
+    *pair = Pair();
+    pair->id = id;
+    pair->actif = true;
+    pair->derniereActivite = now;
+    return pair;
+}
+
+const LinkStats::Pair* LinkStats::pair(uint8_t id) const {
+    for(const Pair& pair : _pairs) {
+        if(pair.actif && pair.id == id) {
+            return &pair;
+        }
+    }
+    return nullptr;
+}
+
+void LinkStats::observerTrame(uint8_t idExpediteur, float rssi, uint32_t now) {
+    Pair* pair = trouver(idExpediteur, now);
+    ++pair->trames;
+    pair->derniereTrame = now;
+    pair->derniereActivite = now;
+
+    if(isnan(pair->rssi)) {
+        pair->rssi = pair->rssiMin = pair->rssiMax = rssi;
+    } else {
+        pair->rssi = pair->rssi * 0.875f + rssi * 0.125f;
+        pair->rssiMin = rssi < pair->rssiMin ? rssi : pair->rssiMin;
+        pair->rssiMax = rssi > pair->rssiMax ? rssi : pair->rssiMax;
+    }
+
+    int32_t classe = ((int32_t)rssi - kRssiMinDbm) / kRssiClasseDb;
+    classe = classe < 0 ? 0 : (classe >= (int32_t)kRssiClasses ? kRssiClasses - 1 : classe);
+    ++pair->histogrammeRssi[classe];
+}
+
+void LinkStats::observerTransaction(uint8_t idDestinataire, int16_t err, uint8_t emissions, uint32_t latenceUs, uint32_t now) {
+    if(err == DutyCycle::kErrBudget || emissions == 0) { // Jamais émise : rien à dire de la liaison
+        return;
+    }
+
+    Pair* pair = trouver(idDestinataire, now);
+    pair->derniereActivite = now;
+    if(err == RADIOLIB_ERR_ADDRESS_NOT_FOUND) {
+        ++pair->refus;
+        return;
+    }
+    if(err != RADIOLIB_ERR_NONE) {
+        ++pair->expirations;
+        return;
+    }
+
+    ++pair->succes;
+    ++pair->succesApres[(emissions < kEmissionsMax ? emissions : kEmissionsMax) - 1];
+
+    pair->latenceUs = pair->succes == 1 ? latenceUs : (pair->latenceUs * 7 + latenceUs) / 8;
+    size_t classe = latenceUs / 1000 / kLatenceClasseMs;
+    ++pair->histogrammeLatence[classe < kLatenceClasses ? classe : kLatenceClasses - 1];
+}
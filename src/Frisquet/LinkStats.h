@@ -0,0 +1,60 @@
+#pragma once
+
+#include <heltec.h>
+
+// Qualité de liaison par appareil distant : RSSI des trames reçues, délai
+// aller-retour et nombre d'émissions des transactions, issue de chaque échange
+// (réponse, absence de réponse, refus 0x83). Permet de repérer une liaison qui
+// se dégrade avant que les zones cessent d'être mises à jour.
+class LinkStats {
+    public:
+        static constexpr size_t kMaxPairs = 8;
+
+        static constexpr int16_t kRssiMinDbm = -120;        // Histogramme RSSI : classes de 10 dB
+        static constexpr uint8_t kRssiClasseDb = 10;
+        static constexpr size_t kRssiClasses = 8;           // -120 .. -40 dBm et au-delà
+
+        static constexpr uint32_t kLatenceClasseMs = 25;    // Histogramme aller-retour : classes de 25 ms
+        static constexpr size_t kLatenceClasses = 13;       // 0 .. 300 ms (fenêtre de réponse) et au-delà
+
+        static constexpr size_t kEmissionsMax = 5;          // Succès après 1 .. 5 émissions et plus
+
+        struct Pair {
+            uint8_t id = 0;
+            bool actif = false;
+
+            // Réception
+            uint32_t trames = 0;
+            uint32_t derniereTrame = 0;
+            uint32_t derniereActivite = 0;  // Trame reçue ou transaction terminée : ordre d'éviction
+            float rssi = NAN;           // Moyenne glissante
+            float rssiMin = NAN;
+            float rssiMax = NAN;
+            uint32_t histogrammeRssi[kRssiClasses] = {0};
+
+            // Transactions adressées à l'appareil
+            uint32_t succes = 0;
+            uint32_t expirations = 0;
+            uint32_t refus = 0;
+            uint32_t succesApres[kEmissionsMax] = {0};
+            uint32_t latenceUs = 0;     // Moyenne glissante de l'aller-retour
+            uint32_t histogrammeLatence[kLatenceClasses] = {0};
+
+            uint32_t transactions() const { return succes + expirations + refus; }
+            float tauxSucces() const { return transactions() ? succes * 100.0f / transactions() : NAN; }
+        };
+
+        void observerTrame(uint8_t idExpediteur, float rssi, uint32_t now);
+
+        // Transaction terminée : latenceUs de l'émission à la réponse (0 sans réponse)
+        void observerTransaction(uint8_t idDestinataire, int16_t err, uint8_t emissions, uint32_t latenceUs, uint32_t now);
+
+        const Pair* pair(uint8_t id) const;
+        const Pair* pairs() const { return _pairs; }
+
+    private:
+        // Appareil suivi, ou emplacement libre / le moins récemment actif réaffecté
+        Pair* trouver(uint8_t id, uint32_t now);
+
+        Pair _pairs[kMaxPairs];
+};
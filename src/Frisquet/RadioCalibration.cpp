@@ -0,0 +1,183 @@
+#include "RadioCalibration.h"
+#include "../Logs.h"
+
+constexpr float RadioCalibration::kDecalagesKHz[];
+constexpr float RadioCalibration::kBandesKHz[];
+
+int16_t RadioCalibration::appliquer(float decalageKHz, float bandeKHz) {
+    bool bandeValide = false;
+    for(float bande : kBandesKHz) {
+        if(fabsf(bande - bandeKHz) < 0.05f) {
+            bandeValide = true;
+        }
+    }
+    if(!bandeValide || isnan(decalageKHz) || fabsf(decalageKHz) > 50.0f) {
+        decalageKHz = 0.0f;
+        bandeKHz = RadioTransport::kRxBandwidthKHz;
+    }
+
+    int16_t err = _transport.setChannel(RadioTransport::kFrequencyMHz + decalageKHz / 1000.0f, bandeKHz);
+    if(err == RADIOLIB_ERR_NONE) {
+        _decalageKHz = decalageKHz;
+        _bandeKHz = bandeKHz;
+    }
+    return err;
+}
+
+int16_t RadioCalibration::regler(float decalageKHz, float bandeKHz) {
+    int16_t err = _transport.setChannel(RadioTransport::kFrequencyMHz + decalageKHz / 1000.0f, bandeKHz);
+    _transport.startReceive();
+    return err;
+}
+
+bool RadioCalibration::demarrer(uint32_t palierMs, Callback callback) {
+    if(_etat == ETAT::EN_COURS) {
+        return false;
+    }
+
+    _palierMs = palierMs < kPalierMinMs ? kPalierMinMs : palierMs;
+    _callback = callback;
+    for(size_t i = 0; i < kPaliers; i++) {
+        _resultats[i] = Palier();
+        _resultats[i].bandeKHz = kBandesKHz[i / kNbDecalages];
+        _resultats[i].decalageKHz = kDecalagesKHz[i % kNbDecalages];
+    }
+
+    info("[RADIO] Calibration : %d paliers de %d s.", kPaliers, _palierMs / 1000);
+    _etat = ETAT::EN_COURS;
+    _pause = false;
+    commencerPalier(0);
+    return true;
+}
+
+void RadioCalibration::annuler() {
+    if(_etat != ETAT::EN_COURS) {
+        return;
+    }
+    regler(_decalageKHz, _bandeKHz);
+    _etat = ETAT::INACTIVE;
+    _pause = false;
+    _callback = nullptr;
+    info("[RADIO] Calibration annulée.");
+}
+
+void RadioCalibration::commencerPalier(size_t i) {
+    _palier = i;
+    _debutPalier = millis();
+    if(regler(_resultats[i].decalageKHz, _resultats[i].bandeKHz) != RADIOLIB_ERR_NONE) {
+        error("[RADIO] Calibration : réglage %+.0f kHz / %.1f kHz refusé.", _resultats[i].decalageKHz, _resultats[i].bandeKHz);
+    }
+}
+
+void RadioCalibration::observer(const RadioFrame& frame) {
+    if(_etat != ETAT::EN_COURS || _pause) {    // Réglage du palier suspendu : trame hors mesure
+        return;
+    }
+    Palier& palier = _resultats[_palier];
+    ++palier.trames;
+    palier.rssiTotal += frame.rssi;
+}
+
+void RadioCalibration::avantEmission() {
+    if(_etat != ETAT::EN_COURS) {
+        return;
+    }
+    uint32_t now = millis();
+    if(!_pause) {
+        _pause = true;
+        _debutPause = now;
+        regler(_decalageKHz, _bandeKHz);
+    }
+    _finPause = now + kPauseEmissionMs;
+}
+
+void RadioCalibration::loop() {
+    if(_etat != ETAT::EN_COURS) {
+        return;
+    }
+
+    uint32_t now = millis();
+    if(_pause) {
+        if((int32_t)(now - _finPause) < 0) {
+            return;
+        }
+        // Retour au réglage du palier, prolongé de la durée de la pause
+        _pause = false;
+        _debutPalier += now - _debutPause;
+        regler(_resultats[_palier].decalageKHz, _resultats[_palier].bandeKHz);
+    }
+
+    if(now - _debutPalier < _palierMs) {
+        return;
+    }
+
+    const Palier& fini = _resultats[_palier];
+    debug("[RADIO] Calibration %+.0f kHz / %.1f kHz : %d trame(s), RSSI %.0f dBm.", fini.decalageKHz, fini.bandeKHz, fini.trames, fini.rssiMoyen());
+
+    if(_palier + 1 < kPaliers) {
+        commencerPalier(_palier + 1);
+        return;
+    }
+    terminer();
+}
+
+void RadioCalibration::terminer() {
+    // Seuls les paliers dont la bande couvre le signal décalé sont candidats (234,3 kHz les couvre tous)
+    uint16_t maximum = 0;
+    for(const Palier& palier : _resultats) {
+        if(couvre(palier.decalageKHz, palier.bandeKHz) && palier.trames > maximum) {
+            maximum = palier.trames;
+        }
+    }
+
+    if(maximum < kTramesMin) {
+        error("[RADIO] Calibration : trafic insuffisant (%d trame(s)), réglage inchangé.", maximum);
+        regler(_decalageKHz, _bandeKHz);
+        _etat = ETAT::ECHEC;
+        _callback = nullptr;
+        return;
+    }
+
+    // Paliers équivalents au meilleur : bande la plus étroite, puis meilleur RSSI, puis plus faible écart
+    const Palier* retenu = nullptr;
+    for(const Palier& palier : _resultats) {
+        if(!couvre(palier.decalageKHz, palier.bandeKHz) || palier.trames * 100 < (uint32_t)maximum * kToleranceTramesPct) {
+            continue;
+        }
+        if(!retenu) {
+            retenu = &palier;
+            continue;
+        }
+        if(palier.bandeKHz != retenu->bandeKHz) {
+            if(palier.bandeKHz < retenu->bandeKHz) {
+                retenu = &palier;
+            }
+            continue;
+        }
+        float ecartRssi = palier.rssiMoyen() - retenu->rssiMoyen();
+        if(ecartRssi > 1.0f || (ecartRssi >= -1.0f && fabsf(palier.decalageKHz) < fabsf(retenu->decalageKHz))) {
+            retenu = &palier;
+        }
+    }
+
+    appliquer(retenu->decalageKHz, retenu->bandeKHz);
+    _transport.startReceive();
+    _etat = ETAT::TERMINEE;
+    info("[RADIO] Calibration terminée : %+.0f kHz, bande %.1f kHz (%d trame(s), RSSI %.0f dBm).", _decalageKHz, _bandeKHz, retenu->trames, retenu->rssiMoyen());
+
+    Callback callback = std::move(_callback);
+    _callback = nullptr;
+    if(callback) {
+        callback(_decalageKHz, _bandeKHz);
+    }
+}
+
+const char* RadioCalibration::nomEtat(ETAT etat) {
+    switch(etat) {
+        case ETAT::INACTIVE: return "inactive";
+        case ETAT::EN_COURS: return "en cours";
+        case ETAT::TERMINEE: return "terminée";
+        case ETAT::ECHEC: return "échec";
+    }
+    return "?";
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <heltec.h>
+#include <functional>
+#include "../RadioTransport.h"
+#include "RadioFrameQueue.h"
+
+// Calibration du canal : balayage de petits écarts de fréquence (tolérance du
+// quartz, ±20 ppm à 868 MHz) et des bandes passantes du SX1262, en écoutant le
+// trafic du réseau. Chaque réglage est conservé un palier ; le réglage retenu
+// maximise les trames reçues, puis préfère la bande la plus étroite (sensibilité)
+// et le meilleur RSSI. Une bande n'est retenue que si elle couvre le signal (Carson)
+// décalé de l'écart essayé. Les émissions du module (relevés, écritures, accusés) se
+// font sur le réglage en vigueur, conservé pendant la fenêtre de réponse : ni elles
+// ni leurs réponses ne dépendent du palier en cours, qui n'en compte pas les trames.
+class RadioCalibration {
+    public:
+        static constexpr float kDecalagesKHz[] = { -20.0f, -10.0f, 0.0f, 10.0f, 20.0f };
+        static constexpr float kBandesKHz[] = { 234.3f, 156.2f };
+        static constexpr float kCarsonKHz = 125.0f;         // Déviation 50 kHz à 25 kbps : 2 × (50 + 12,5)
+        static constexpr size_t kNbDecalages = sizeof(kDecalagesKHz) / sizeof(kDecalagesKHz[0]);
+        static constexpr size_t kPaliers = kNbDecalages * sizeof(kBandesKHz) / sizeof(kBandesKHz[0]);
+
+        static constexpr uint32_t kPalierDefautMs = 120000;
+        static constexpr uint32_t kPalierMinMs = 10000;
+        static constexpr uint16_t kTramesMin = 3;           // En deçà sur le meilleur palier : réglage inchangé
+        static constexpr uint8_t kToleranceTramesPct = 90;  // Paliers équivalents au meilleur
+        static constexpr uint32_t kPauseEmissionMs = 400;   // Réglage en vigueur après une émission : fenêtre de réponse (300 ms) et marge
+
+        enum ETAT : uint8_t {
+            INACTIVE,
+            EN_COURS,
+            TERMINEE,
+            ECHEC           // Trafic insuffisant : réglage précédent rétabli
+        };
+
+        struct Palier {
+            float decalageKHz = 0.0f;
+            float bandeKHz = 0.0f;
+            uint16_t trames = 0;
+            float rssiTotal = 0.0f;
+
+            float rssiMoyen() const { return trames ? rssiTotal / trames : NAN; }
+        };
+
+        // Rappelé avec le réglage retenu, pour être persisté
+        typedef std::function<void(float decalageKHz, float bandeKHz)> Callback;
+
+        explicit RadioCalibration(RadioTransport& transport) : _transport(transport) {}
+
+        // Réglage courant (démarrage : valeurs de la configuration). Bande inconnue : bande nominale.
+        int16_t appliquer(float decalageKHz, float bandeKHz);
+
+        bool demarrer(uint32_t palierMs, Callback callback);
+        void annuler();
+
+        // Trame reçue (CRC valide) pendant le palier en cours
+        void observer(const RadioFrame& frame);
+
+        // Avant chaque émission : pendant la calibration, le réglage en vigueur est rétabli
+        // jusqu'à kPauseEmissionMs après la dernière émission, puis le palier reprend
+        void avantEmission();
+
+        // Passage au palier suivant, puis choix du réglage : à appeler à chaque tour de boucle
+        void loop();
+
+        ETAT etat() const { return _etat; }
+        bool enCours() const { return _etat == ETAT::EN_COURS; }
+        size_t palierCourant() const { return _palier; }
+        uint32_t palierMs() const { return _palierMs; }
+        const Palier& palier(size_t i) const { return _resultats[i]; }
+        float decalageKHz() const { return _decalageKHz; }
+        float bandeKHz() const { return _bandeKHz; }
+
+        static const char* nomEtat(ETAT etat);
+
+    private:
+        int16_t regler(float decalageKHz, float bandeKHz);
+        static bool couvre(float decalageKHz, float bandeKHz) { return bandeKHz >= kCarsonKHz + 2.0f * fabsf(decalageKHz); }
+        void commencerPalier(size_t i);
+        void terminer();
+
+        RadioTransport& _transport;
+
+        ETAT _etat = ETAT::INACTIVE;
+        Palier _resultats[kPaliers];
+        size_t _palier = 0;
+        uint32_t _palierMs = kPalierDefautMs;
+        uint32_t _debutPalier = 0;
+        bool _pause = false;            // Réglage en vigueur rétabli pour une émission
+        uint32_t _debutPause = 0;
+        uint32_t _finPause = 0;
+        Callback _callback;
+
+        float _decalageKHz = 0.0f;
+        float _bandeKHz = RadioTransport::kRxBandwidthKHz;
+};
@@ -0,0 +1,182 @@
+#include "RadioFrameLog.h"
+#include <TimeLib.h>
+
+const char* RadioFrameLog::nomIssue(ISSUE issue) {
+    switch(issue) {
+        case RECUE: return "RECUE";
+        case REPONSE: return "REPONSE";
+        case INTERCEPTEE: return "INTERCEPTEE";
+        case DOUBLON: return "DOUBLON";
+        case ROUTEE: return "ROUTEE";
+        case IGNOREE: return "IGNOREE";
+        case PERDUE: return "PERDUE";
+        case EMISE: return "EMISE";
+        case ECHEC: return "ECHEC";
+        case DELESTEE: return "DELESTEE";
+        default: return "?";
+    }
+}
+
+const char* RadioFrameLog::nomType(uint8_t type) {
+    switch(type) {
+        case RadioMessageType::READ: return "READ";
+        case RadioMessageType::INIT: return "INIT";
+        case RadioMessageType::ASSOCIATION: return "ASSOCIATION";
+        case RadioMessageType::REFUS: return "REFUS";
+        default: return "INCONNU";
+    }
+}
+
+void RadioFrameLog::situer(Entete& e, const byte* trame, size_t length) {
+    e.adresse = e.tailleZone = e.adresseEcriture = e.tailleEcriture = 0;
+    if(length < sizeof(RadioTrameHeader)) {
+        return;
+    }
+
+    RadioTrameHeader header;
+    memcpy(&header, trame, sizeof(header));
+    const byte* corps = trame + sizeof(RadioTrameHeader);
+    size_t reste = length - sizeof(RadioTrameHeader);
+
+    // Réponse : zone de la requête de même numéro échangée entre les mêmes appareils
+    if(header.idReception & 0x80) {
+        for(const Demande& demande : _demandes) {
+            if(demande.taille + demande.tailleEcriture > 0 && demande.idMessage == header.idMessage &&
+               demande.expediteur == header.idDestinataire && demande.destinataire == header.idExpediteur) {
+                e.adresse = demande.adresse;
+                e.tailleZone = demande.taille;
+                e.adresseEcriture = demande.adresseEcriture;
+                e.tailleEcriture = demande.tailleEcriture;
+                return;
+            }
+        }
+        return;
+    }
+
+    if(header.type == RadioMessageType::READ && reste >= sizeof(RadioTrameAsk)) {
+        RadioTrameAsk ask;
+        memcpy(&ask, corps, sizeof(ask));
+        e.adresse = ask.adresseMemoire.toUInt16();
+        e.tailleZone = ask.tailleMemoire.toUInt16();
+    } else if(header.type == RadioMessageType::INIT && reste >= sizeof(RadioTrameInit)) {
+        RadioTrameInit init;
+        memcpy(&init, corps, sizeof(init));
+        e.adresse = init.adresseMemoireLecture.toUInt16();
+        e.tailleZone = init.tailleMemoireLecture.toUInt16();
+        e.adresseEcriture = init.adresseMemoireEcriture.toUInt16();
+        e.tailleEcriture = init.tailleMemoireEcriture.toUInt16();
+    } else {
+        return;
+    }
+
+    Demande& demande = _demandes[_prochaineDemande];
+    _prochaineDemande = (_prochaineDemande + 1) % kDemandes;
+    demande.expediteur = header.idExpediteur;
+    demande.destinataire = header.idDestinataire;
+    demande.idMessage = header.idMessage;
+    demande.adresse = e.adresse;
+    demande.taille = e.tailleZone;
+    demande.adresseEcriture = e.adresseEcriture;
+    demande.tailleEcriture = e.tailleEcriture;
+}
+
+bool RadioFrameLog::correspond(const Entete& e, const uint8_t* donnees, const Filtre& filtre) {
+    if(filtre.appareil < 0 && filtre.type < 0 && filtre.adresse < 0) {
+        return true;
+    }
+    if(e.taille - sizeof(Entete) < sizeof(RadioTrameHeader)) {
+        return false;
+    }
+
+    RadioTrameHeader header;
+    memcpy(&header, donnees, sizeof(header));
+    if(filtre.appareil >= 0 && header.idExpediteur != filtre.appareil && header.idDestinataire != filtre.appareil) {
+        return false;
+    }
+    if(filtre.type >= 0 && (header.type & 0x7F) != (filtre.type & 0x7F)) {
+        return false;
+    }
+    if(filtre.adresse >= 0) {
+        auto contient = [&](uint16_t adresse, uint16_t taille) {
+            return taille > 0 && filtre.adresse >= adresse && filtre.adresse < (int32_t)adresse + taille;
+        };
+        return contient(e.adresse, e.tailleZone) || contient(e.adresseEcriture, e.tailleEcriture);
+    }
+    return true;
+}
+
+uint32_t RadioFrameLog::enregistrer(bool rx, const byte* trame, size_t length, float rssi, ISSUE issue) {
+    if(!trame) {
+        length = 0;
+    }
+    length = length < RADIOLIB_SX126X_MAX_PACKET_LENGTH ? length : RADIOLIB_SX126X_MAX_PACKET_LENGTH;
+
+    Entete e;
+    e.rx = rx ? 1 : 0;
+    e.issue = issue;
+    e.rssi = isnan(rssi) ? kSansRssi : (int16_t)lroundf(rssi * 10);
+    e.time = now();
+    e.millis = millis();
+
+    Arena::Verrou guard(_arena);
+    situer(e, trame, length);
+    size_t offset = _arena.ajouter(e, trame, length);
+    _recentes[e.seq % kRecentes] = offset;
+    return e.seq;
+}
+
+void RadioFrameLog::qualifier(uint32_t seq, ISSUE issue) {
+    Arena::Verrou guard(_arena);
+    uint32_t prochain = _arena.prochainSeq();
+    if(seq >= prochain || prochain - seq > kRecentes || seq < _arena.premierSeq()) {
+        return;
+    }
+    size_t offset = _recentes[seq % kRecentes];
+    if(_arena.entete(offset).seq == seq) {
+        _arena.entree(offset)[offsetof(Entete, issue)] = issue;
+    }
+}
+
+bool RadioFrameLog::lire(uint32_t& seq, Trame& out, const Filtre& filtre) {
+    Arena::Verrou guard(_arena);
+    size_t offset;
+    auto retenue = [this, &filtre](const Entete& e, size_t offset) { return correspond(e, _arena.corps(offset), filtre); };
+    if(!_arena.trouver(seq, retenue, offset)) {
+        seq = _arena.prochainSeq();     // Plus rien pour ce filtre : inutile de reparcourir ces trames
+        return false;
+    }
+
+    Entete e = _arena.entete(offset);
+    out.seq = e.seq;
+    out.time = e.time;
+    out.millis = e.millis;
+    out.rssi = e.rssi == kSansRssi ? NAN : e.rssi / 10.0f;
+    out.rx = e.rx != 0;
+    out.issue = (ISSUE)e.issue;
+    out.adresse = e.adresse;
+    out.taille = e.tailleZone;
+    out.adresseEcriture = e.adresseEcriture;
+    out.tailleEcriture = e.tailleEcriture;
+    out.length = e.taille - sizeof(Entete);
+    memcpy(out.donnees, _arena.corps(offset), out.length);
+
+    seq = e.seq + 1;
+    return true;
+}
+
+uint32_t RadioFrameLog::chercherDebut(size_t limit, const Filtre& filtre) {
+    Arena::Verrou guard(_arena);
+    return _arena.chercherDebut(limit, [this, &filtre](const Entete& e, size_t offset) {
+        return correspond(e, _arena.corps(offset), filtre);
+    });
+}
+
+uint32_t RadioFrameLog::prochainSeq() {
+    Arena::Verrou guard(_arena);
+    return _arena.prochainSeq();
+}
+
+void RadioFrameLog::vider() {
+    Arena::Verrou guard(_arena);
+    _arena.vider();
+}
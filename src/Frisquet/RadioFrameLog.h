@@ -0,0 +1,111 @@
+#pragma once
+
+#include <heltec.h>
+#include <RadioLib.h>
+#include "Trames.h"
+#include "../RingArena.h"
+
+// Journal des trames radio brutes, séparé des logs : chaque trame émise ou reçue est
+// copiée entière (jusqu'à 255 octets) avec son sens, son horodatage, son RSSI et son
+// issue, dans une arène circulaire d'entrées de taille variable. L'hexadécimal et le
+// décodage ne sont produits qu'à la lecture (/api/radio/frames).
+class RadioFrameLog {
+    public:
+        static constexpr size_t kArenaSize = 16384;     // ~300 trames usuelles
+        static constexpr size_t kDemandes = 4;          // Requêtes retenues pour situer la zone des réponses
+        static constexpr size_t kRecentes = 8;          // Trames encore qualifiables
+
+        enum ISSUE : uint8_t {
+            RECUE,          // Remise au gestionnaire, pas encore traitée
+            REPONSE,        // Consommée par la transaction en cours
+            INTERCEPTEE,    // Réponse attendue par un appareil à l'écoute
+            DOUBLON,        // Répétition d'une trame déjà traitée
+            ROUTEE,         // Traitée par au moins un appareil
+            IGNOREE,        // Trop courte, ou destinée à aucun appareil
+            PERDUE,         // File de réception pleine
+            EMISE,
+            ECHEC,          // Erreur d'émission
+            DELESTEE        // Budget d'émission épuisé
+        };
+
+        // Critères de lecture, -1 : sans contrainte
+        struct Filtre {
+            int16_t appareil = -1;      // Expéditeur ou destinataire
+            int16_t type = -1;          // Type de message, bit de réponse ignoré (REFUS : READ)
+            int32_t adresse = -1;       // Comprise dans la zone lue ou écrite
+        };
+
+        struct Trame {
+            uint32_t seq = 0;
+            time_t time = 0;
+            uint32_t millis = 0;
+            float rssi = NAN;           // Émission : NAN
+            bool rx = false;
+            ISSUE issue = RECUE;
+            uint16_t adresse = 0;       // Zone mémoire de la requête, ou de la requête à laquelle répond la trame
+            uint16_t taille = 0;        // 0 : aucune zone
+            uint16_t adresseEcriture = 0;
+            uint16_t tailleEcriture = 0;
+            uint8_t length = 0;
+            byte donnees[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+        };
+
+        // Copie de la trame, sans mise en forme ; retourne son numéro pour qualifier()
+        uint32_t enregistrer(bool rx, const byte* trame, size_t length, float rssi, ISSUE issue);
+
+        // Issue connue après le traitement (doublon, routage...) : sans effet si la trame a été oubliée
+        void qualifier(uint32_t seq, ISSUE issue);
+
+        // Lecture séquentielle, comme Logs::lire : seq est positionné sur la trame suivante,
+        // ou sur prochainSeq() s'il n'y en a plus
+        bool lire(uint32_t& seq, Trame& out, const Filtre& filtre);
+
+        // Numéro de la première des `limit` dernières trames correspondant au filtre
+        uint32_t chercherDebut(size_t limit, const Filtre& filtre);
+        uint32_t prochainSeq();
+        void vider();
+
+        size_t trames() const { return _arena.entrees(); }
+        size_t octetsUtilises() const { return _arena.octetsUtilises(); }
+
+        static const char* nomIssue(ISSUE issue);
+        static const char* nomType(uint8_t type);
+
+    private:
+        struct Entete {
+            uint16_t taille;            // Entrée complète ; 0 : fin de l'arène, reprise au début
+            uint8_t rx;
+            uint8_t issue;
+            int16_t rssi;               // Dixièmes de dBm ; kSansRssi en émission
+            uint16_t adresse;
+            uint16_t tailleZone;
+            uint16_t adresseEcriture;
+            uint16_t tailleEcriture;
+            uint32_t seq;
+            uint32_t time;
+            uint32_t millis;
+        };
+
+        struct Demande {
+            uint8_t expediteur = 0;
+            uint8_t destinataire = 0;
+            uint8_t idMessage = 0;
+            uint16_t adresse = 0;
+            uint16_t taille = 0;
+            uint16_t adresseEcriture = 0;
+            uint16_t tailleEcriture = 0;
+        };
+
+        static constexpr int16_t kSansRssi = INT16_MIN;
+
+        void situer(Entete& e, const byte* trame, size_t length);
+        static bool correspond(const Entete& e, const uint8_t* donnees, const Filtre& filtre);
+
+        // Écrite par la tâche radio, lue par le portail et l'archive
+        typedef RingArena<Entete, kArenaSize> Arena;
+        Arena _arena;
+        size_t _recentes[kRecentes] = {0};   // Position des dernières trames, par seq % kRecentes
+
+        Demande _demandes[kDemandes];
+        size_t _prochaineDemande = 0;
+};
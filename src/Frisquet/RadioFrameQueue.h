@@ -0,0 +1,78 @@
+#pragma once
+
+#include <heltec.h>
+#include <RadioLib.h>
+#include <atomic>
+
+// Trame radio brute telle que reçue par le SX1262
+struct RadioFrame {
+    byte data[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    size_t length = 0;
+    float rssi = 0;
+    uint32_t timestamp = 0;     // micros() relevé dans l'interruption DIO
+    uint32_t journal = 0;       // Numéro dans RadioFrameLog, pour en donner l'issue
+};
+
+// File circulaire à capacité fixe, un seul producteur (chemin interruption radio)
+// et un seul consommateur (FrisquetManager::loop). Aucune allocation, aucun verrou.
+template <size_t N>
+class RadioFrameQueueT {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "La capacité doit être une puissance de 2");
+
+    public:
+        // Côté producteur : réserve l'emplacement suivant, nullptr si la file est pleine
+        RadioFrame* reserve() {
+            size_t head = _head.load(std::memory_order_relaxed);
+            if (head - _tail.load(std::memory_order_acquire) >= N) {
+                ++_overflows;
+                return nullptr;
+            }
+            return &_frames[head & (N - 1)];
+        }
+
+        // Côté producteur : publie l'emplacement réservé
+        void commit() {
+            size_t head = _head.load(std::memory_order_relaxed) + 1;
+            _head.store(head, std::memory_order_release);
+            ++_pushed;
+
+            size_t depth = head - _tail.load(std::memory_order_acquire);
+            if (depth > _highWater) {
+                _highWater = depth;
+            }
+        }
+
+        // Côté consommateur : copie la trame la plus ancienne
+        bool pop(RadioFrame& out) {
+            size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail == _head.load(std::memory_order_acquire)) {
+                return false;
+            }
+            const RadioFrame& frame = _frames[tail & (N - 1)];
+            out.length = frame.length;
+            out.rssi = frame.rssi;
+            out.timestamp = frame.timestamp;
+            memcpy(out.data, frame.data, frame.length);
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const { return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire); }
+        size_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+        static constexpr size_t capacity() { return N; }
+
+        uint32_t getPushed() const { return _pushed; }
+        uint32_t getOverflows() const { return _overflows; }
+        size_t getHighWater() const { return _highWater; }
+
+    private:
+        RadioFrame _frames[N];
+        std::atomic<size_t> _head{0};
+        std::atomic<size_t> _tail{0};
+
+        volatile uint32_t _pushed = 0;
+        volatile uint32_t _overflows = 0;
+        volatile size_t _highWater = 0;
+};
+
+typedef RadioFrameQueueT<8> RadioFrameQueue;
@@ -0,0 +1,255 @@
+#include "RadioTransaction.h"
+#include "FrisquetRadio.h"
+#include "../Logs.h"
+
+uint32_t RadioTransactionEngine::submit(const Request& request, Callback callback) {
+    size_t longueurTrame = sizeof(FrisquetRadio::RadioTrameHeader) + request.bodyLength;
+    if(longueurTrame > RADIOLIB_SX126X_MAX_PACKET_LENGTH) {
+        return 0;
+    }
+
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        Transaction& transaction = _transactions[i];
+        if(transaction.state != State::LIBRE) {
+            continue;
+        }
+
+        FrisquetRadio::RadioTrameHeader header;
+        header.idExpediteur = request.idExpediteur;
+        header.idDestinataire = request.idDestinataire;
+        header.idAssociation = request.idAssociation;
+        header.idMessage = request.idMessage;
+        header.idReception = request.idReception;
+        header.type = request.type;
+
+        memcpy(transaction.trame, &header, sizeof(header));
+        if(request.bodyLength > 0) {
+            memcpy(&transaction.trame[sizeof(header)], request.body, request.bodyLength);
+        }
+        transaction.longueurTrame = longueurTrame;
+
+        transaction.idExpediteur = request.idDestinataire;
+        transaction.idDestinataire = request.idExpediteur;
+        transaction.idMessage = request.idMessage;
+        transaction.idReception = request.idReception | 0x80;
+        transaction.type = request.type;
+
+        uint32_t now = millis();
+        transaction.attemptsLeft = request.attempts > 0 ? request.attempts : 1;
+        transaction.timeoutMs = request.timeoutMs;
+        transaction.deadline = now + request.queueTimeoutMs;
+        transaction.nextAttempt = now;
+        transaction.longueurReponse = 0;
+        transaction.err = RADIOLIB_ERR_NONE;
+        transaction.callback = callback;
+        transaction.priorite = request.priorite;
+        transaction.differee = false;
+        transaction.emissions = 0;
+        transaction.channelWaits = 0;
+        transaction.latenceUs = 0;
+        transaction.id = _nextId++;
+        if(_nextId == 0) {
+            _nextId = 1;
+        }
+        transaction.state = State::EN_ATTENTE;
+        return transaction.id;
+    }
+
+    error("[RADIO] File de transactions pleine, requête ignorée.");
+    return 0;
+}
+
+bool RadioTransactionEngine::onFrame(const RadioFrame& frame) {
+    if(_inFlight < 0 || frame.length < sizeof(FrisquetRadio::RadioTrameHeader)) {
+        return false;
+    }
+
+    Transaction& transaction = _transactions[_inFlight];
+    const FrisquetRadio::RadioTrameHeader* header = (const FrisquetRadio::RadioTrameHeader*)frame.data;
+
+    // Le REFUS reprend l'en-tête de la requête : un refus tardif d'une requête précédente est ignoré
+    if(header->idExpediteur != transaction.idExpediteur ||
+       header->idDestinataire != transaction.idDestinataire ||
+       header->idMessage != transaction.idMessage ||
+       header->idReception != transaction.idReception) {
+        return false;
+    }
+
+    if(header->type == RadioMessageType::REFUS) {
+        transaction.latenceUs = frame.timestamp - transaction.emissionUs;
+        finish(transaction, RADIOLIB_ERR_ADDRESS_NOT_FOUND);
+        return true;
+    }
+
+    if(header->type != transaction.type) {
+        return false;
+    }
+
+    memcpy(transaction.reponse, frame.data, frame.length);
+    transaction.longueurReponse = frame.length;
+    transaction.latenceUs = frame.timestamp - transaction.emissionUs;
+    finish(transaction, RADIOLIB_ERR_NONE);
+    return true;
+}
+
+void RadioTransactionEngine::loop() {
+    uint32_t now = millis();
+
+    if(_inFlight >= 0) {
+        Transaction& transaction = _transactions[_inFlight];
+        if((int32_t)(now - transaction.deadline) >= 0) {
+            finish(transaction, RADIOLIB_ERR_RX_TIMEOUT);
+        } else if((int32_t)(now - transaction.replyDeadline) >= 0) {
+            if(transaction.attemptsLeft == 0) {
+                finish(transaction, RADIOLIB_ERR_RX_TIMEOUT);
+            } else if((int32_t)(now - transaction.nextAttempt) >= 0 && autoriser(transaction)) {
+                bool relance = transaction.emissions > 0;
+                if(transmit(transaction, now) && relance) {
+                    ++_retransmissions;
+                }
+            }
+        }
+    }
+
+    expire(now);
+
+    if(_inFlight < 0) {
+        startNext(now);
+    }
+
+    // Rappels hors de la boucle de recherche : un rappel peut soumettre une nouvelle transaction
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        Transaction& transaction = _transactions[i];
+        if(transaction.state != State::TERMINEE) {
+            continue;
+        }
+
+        Callback callback = transaction.callback;
+        transaction.callback = nullptr;
+        transaction.state = State::LIBRE;
+
+        if(callback) {
+            callback(transaction.err, transaction.reponse, transaction.longueurReponse);
+        }
+    }
+}
+
+bool RadioTransactionEngine::isPending(uint32_t id) const {
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        if(_transactions[i].id == id && _transactions[i].state != State::LIBRE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t RadioTransactionEngine::pending() const {
+    size_t count = 0;
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        if(_transactions[i].state == State::EN_ATTENTE || _transactions[i].state == State::EMISE) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void RadioTransactionEngine::startNext(uint32_t now) {
+    int8_t next = -1;
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        if(_transactions[i].state != State::EN_ATTENTE) {
+            continue;
+        }
+        if(next < 0 || _transactions[i].priorite < _transactions[next].priorite ||
+           (_transactions[i].priorite == _transactions[next].priorite && (int32_t)(_transactions[i].id - _transactions[next].id) < 0)) {
+            next = i;
+        }
+    }
+
+    if(next < 0) {
+        return;
+    }
+
+    Transaction& transaction = _transactions[next];
+    if(!autoriser(transaction)) {
+        // Le debug est abandonné tout de suite, le reste attend son échéance
+        if(transaction.priorite == DutyCycle::PRIORITE::DEBUG) {
+            _radio.dutyCycle().compterDelestee();
+            finish(transaction, DutyCycle::kErrBudget);
+        }
+        return;
+    }
+
+    // L'échéance globale part de la première émission : l'attente derrière d'autres
+    // transactions ne consomme pas le temps de réponse
+    _inFlight = next;
+    transaction.state = State::EMISE;
+    transaction.deadline = now + transaction.timeoutMs;
+    transmit(transaction, now);
+}
+
+void RadioTransactionEngine::expire(uint32_t now) {
+    for(size_t i = 0; i < kMaxTransactions; i++) {
+        Transaction& transaction = _transactions[i];
+        if(transaction.state != State::EN_ATTENTE || (int32_t)(now - transaction.deadline) < 0) {
+            continue;
+        }
+        if(transaction.differee) {
+            _radio.dutyCycle().compterDelestee();
+            error("[RADIO] Budget d'émission épuisé, requête %s abandonnée.", DutyCycle::nomPriorite(transaction.priorite));
+        }
+        finish(transaction, transaction.differee ? DutyCycle::kErrBudget : RADIOLIB_ERR_TX_TIMEOUT);
+    }
+}
+
+bool RadioTransactionEngine::autoriser(Transaction& transaction) {
+    DutyCycle& dutyCycle = _radio.dutyCycle();
+    if(dutyCycle.autoriser(transaction.priorite, DutyCycle::dureeEmissionUs(transaction.longueurTrame))) {
+        return true;
+    }
+    if(!transaction.differee) {
+        transaction.differee = true;
+        dutyCycle.compterDifferee();
+    }
+    return false;
+}
+
+bool RadioTransactionEngine::transmit(Transaction& transaction, uint32_t now) {
+    // Écoute avant émission : un autre appareil émet, nouvelle tentative après un délai aléatoire
+    if(transaction.channelWaits < kMaxChannelWaits && !_radio.isChannelFree(FrisquetRadio::kSeuilCanalLibreDbm)) {
+        ++transaction.channelWaits;
+        ++_channelBusy;
+        transaction.replyDeadline = now;
+        transaction.nextAttempt = now + random(kBackoffMinMs, kBackoffMaxMs + 1);
+        return false;
+    }
+
+    --transaction.attemptsLeft;
+    ++transaction.emissions;
+    transaction.emissionUs = micros();
+    int16_t err = _radio.transmitFrame(transaction.trame, transaction.longueurTrame, transaction.priorite);
+    transaction.err = err;
+
+    now = millis();
+    // En cas d'échec d'émission, la fenêtre de réponse est ramenée à la pause de relance
+    transaction.replyDeadline = now + (err == RADIOLIB_ERR_NONE ? kReplyWindowMs : 0);
+    transaction.nextAttempt = transaction.replyDeadline + kRetryGapMs;
+    return true;
+}
+
+void RadioTransactionEngine::finish(Transaction& transaction, int16_t err) {
+    if(_inFlight >= 0 && &_transactions[_inFlight] == &transaction) {
+        _inFlight = -1;
+    }
+    transaction.err = err;
+    transaction.state = State::TERMINEE;
+
+    if(err == RADIOLIB_ERR_NONE) {
+        ++_completed;
+        if(transaction.emissions > 0) {
+            ++_successAfter[(transaction.emissions < kDefaultAttempts ? transaction.emissions : kDefaultAttempts) - 1];
+        }
+    } else {
+        ++_failed;
+    }
+    _radio.liens().observerTransaction(transaction.idExpediteur, err, transaction.emissions, transaction.latenceUs, millis());
+}
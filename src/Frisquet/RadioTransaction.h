@@ -0,0 +1,124 @@
+#pragma once
+
+#include <heltec.h>
+#include <functional>
+#include "RadioFrameQueue.h"
+#include "DutyCycle.h"
+
+class FrisquetRadio;
+
+// Moteur de requêtes/réponses non bloquant : les appelants soumettent une trame
+// READ ou INIT et sont rappelés à la réception de la réponse (ou à l'échec),
+// pendant que la boucle principale continue de servir MQTT et le portail.
+class RadioTransactionEngine {
+    public:
+        typedef std::function<void(int16_t err, const byte* donnees, size_t length)> Callback;
+
+        static constexpr size_t kMaxTransactions = 8;
+        static constexpr uint8_t kDefaultAttempts = 5;
+        static constexpr uint32_t kReplyWindowMs = 300;     // Attente d'une réponse après chaque émission
+        static constexpr uint32_t kRetryGapMs = 30;         // Pause avant réémission
+        static constexpr uint32_t kDefaultTimeoutMs = 5000; // Échéance globale d'une transaction, depuis sa première émission
+        static constexpr uint32_t kDefaultQueueTimeoutMs = 15000;   // Attente en file au plus (8 transactions en échec ~13 s)
+        static constexpr uint32_t kBackoffMinMs = 5;        // Canal occupé : attente aléatoire avant nouvelle écoute
+        static constexpr uint32_t kBackoffMaxMs = 40;
+        static constexpr uint8_t kMaxChannelWaits = 5;      // Au-delà, émission malgré le canal occupé
+
+        struct Request {
+            uint8_t idExpediteur = 0x00;
+            uint8_t idDestinataire = 0x00;
+            uint8_t idAssociation = 0x00;
+            uint8_t idMessage = 0x00;
+            uint8_t idReception = 0x01;
+            uint8_t type = 0x00;
+            const byte* body = nullptr;     // Corps après l'en-tête (RadioTrameAsk/RadioTrameInit + données)
+            size_t bodyLength = 0;
+            uint8_t attempts = kDefaultAttempts;
+            uint32_t timeoutMs = kDefaultTimeoutMs;
+            uint32_t queueTimeoutMs = kDefaultQueueTimeoutMs;
+            DutyCycle::PRIORITE priorite = DutyCycle::PRIORITE::PERIODIQUE;
+        };
+
+        explicit RadioTransactionEngine(FrisquetRadio& radio) : _radio(radio) {}
+
+        // Retourne l'identifiant de la transaction, 0 si la file est pleine
+        uint32_t submit(const Request& request, Callback callback);
+
+        // Appelé pour chaque trame reçue, true si elle répond à la transaction émise
+        bool onFrame(const RadioFrame& frame);
+
+        // Émission (priorité la plus haute d'abord, dans la limite du budget d'émission),
+        // relances et expiration : à appeler à chaque tour de boucle
+        void loop();
+
+        bool isPending(uint32_t id) const;
+        bool busy() const { return _inFlight >= 0; }
+        size_t pending() const;
+
+        uint32_t getCompleted() const { return _completed; }
+        uint32_t getFailed() const { return _failed; }
+        uint32_t getRetransmissions() const { return _retransmissions; }
+        uint32_t getChannelBusy() const { return _channelBusy; }
+
+        // Succès selon le nombre d'émissions nécessaires (dernière case : kDefaultAttempts et plus)
+        uint32_t getSuccessAfter(uint8_t emissions) const { return emissions >= 1 && emissions <= kDefaultAttempts ? _successAfter[emissions - 1] : 0; }
+
+    private:
+        enum State : uint8_t {
+            LIBRE,
+            EN_ATTENTE,     // En file, pas encore émise
+            EMISE,          // Émise, réponse attendue
+            TERMINEE        // Réponse reçue ou échec, rappel à déclencher
+        };
+
+        struct Transaction {
+            uint32_t id = 0;
+            State state = State::LIBRE;
+
+            byte trame[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+            size_t longueurTrame = 0;
+
+            // En-tête de la réponse attendue
+            uint8_t idExpediteur = 0x00;
+            uint8_t idDestinataire = 0x00;
+            uint8_t idMessage = 0x00;
+            uint8_t idReception = 0x00;
+            uint8_t type = 0x00;
+
+            DutyCycle::PRIORITE priorite = DutyCycle::PRIORITE::PERIODIQUE;
+            bool differee = false;      // Retenue au moins une fois faute de budget
+
+            uint8_t attemptsLeft = 0;
+            uint8_t emissions = 0;
+            uint8_t channelWaits = 0;
+            uint32_t timeoutMs = 0;
+            uint32_t deadline = 0;      // En file : échéance d'attente ; émise : échéance globale
+            uint32_t replyDeadline = 0;
+            uint32_t nextAttempt = 0;
+            uint32_t emissionUs = 0;    // Début de la dernière émission
+            uint32_t latenceUs = 0;     // Aller-retour jusqu'à l'interruption de réception
+
+            int16_t err = 0;
+            byte reponse[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+            size_t longueurReponse = 0;
+
+            Callback callback;
+        };
+
+        void startNext(uint32_t now);
+        void expire(uint32_t now);
+        bool autoriser(Transaction& transaction);
+        bool transmit(Transaction& transaction, uint32_t now);
+        void finish(Transaction& transaction, int16_t err);
+
+        FrisquetRadio& _radio;
+        Transaction _transactions[kMaxTransactions];
+        int8_t _inFlight = -1;
+        uint32_t _nextId = 1;
+
+        uint32_t _completed = 0;
+        uint32_t _failed = 0;
+        uint32_t _retransmissions = 0;
+        uint32_t _channelBusy = 0;
+        uint32_t _successAfter[kDefaultAttempts] = {0};
+};
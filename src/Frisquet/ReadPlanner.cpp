@@ -0,0 +1,280 @@
+#include "ReadPlanner.h"
+#include "FrisquetRadio.h"
+#include "FrisquetDevice.h"
+#include "../Logs.h"
+#include <algorithm>
+
+uint8_t ReadPlanner::declarer(const char* nom, FrisquetDevice& lecteur, uint16_t adresse, uint16_t taille, uint32_t periodeMs, Callback callback) {
+    if(_besoins.size() >= kAucun || taille == 0 || taille > kBlocMaxMots) {
+        return kAucun;
+    }
+
+    Besoin besoin;
+    besoin.nom = nom;
+    besoin.lecteur = &lecteur;
+    besoin.adresse = adresse;
+    besoin.taille = taille;
+    besoin.periodeMs = periodeMs;
+    besoin.periodeMinMs = periodeMs;
+    besoin.periodeMaxMs = periodeMs;
+    besoin.callback = callback;
+    _besoins.push_back(besoin);
+    return _besoins.size() - 1;
+}
+
+bool ReadPlanner::demander(uint8_t id) {
+    if(id >= _besoins.size() || !_besoins[id].lecteur->estAssocie()) {
+        return false;
+    }
+    Besoin& besoin = _besoins[id];
+    besoin.demande = true;
+    besoin.prochainEssai = millis();    // Demande explicite : pas d'attente après un échec
+    return true;
+}
+
+void ReadPlanner::bornerPeriode(uint8_t id, uint32_t periodeMinMs, uint32_t periodeMaxMs) {
+    if(id >= _besoins.size() || _besoins[id].periodeMs == 0 || periodeMinMs == 0 || periodeMinMs > periodeMaxMs) {
+        return;
+    }
+    Besoin& besoin = _besoins[id];
+    besoin.periodeMinMs = periodeMinMs;
+    besoin.periodeMaxMs = periodeMaxMs;
+    besoin.periodeMs = std::min(std::max(besoin.periodeMs, periodeMinMs), periodeMaxMs);
+}
+
+void ReadPlanner::signalerVariation(uint8_t id, bool variation) {
+    if(id >= _besoins.size() || _besoins[id].periodeMs == 0) {
+        return;
+    }
+    Besoin& besoin = _besoins[id];
+    uint32_t periode = variation ? besoin.periodeMs / 2 : besoin.periodeMs + besoin.periodeMs / 100 * kAllongementPct;
+    periode = std::min(std::max(periode, besoin.periodeMinMs), besoin.periodeMaxMs);
+    if(periode != besoin.periodeMs) {
+        debug("[RADIO] Relevé %s toutes les %d s (%s).", besoin.nom, periode / 1000, variation ? "valeurs en mouvement" : "valeurs stables");
+        besoin.periodeMs = periode;
+    }
+}
+
+bool ReadPlanner::estDu(const Besoin& besoin, uint32_t now) const {
+    if(besoin.enCours || !besoin.lecteur->estAssocie() || (int32_t)(now - besoin.prochainEssai) < 0) {
+        return false;
+    }
+    if(besoin.demande) {
+        return true;
+    }
+    if(besoin.periodeMs == 0) {
+        return false;
+    }
+    if(besoin.lectures + besoin.servies == 0) {
+        return true;
+    }
+
+    return _radio.trafic().relevePret(besoin.derniereLivraison, besoin.periodeMs, now);
+}
+
+bool ReadPlanner::estAnticipable(const Besoin& besoin, uint32_t now) const {
+    if(besoin.enCours || besoin.estIsole(now) || besoin.periodeMs == 0 || besoin.lectures + besoin.servies == 0 ||
+       !besoin.lecteur->estAssocie() || (int32_t)(now - besoin.prochainEssai) < 0) {
+        return false;
+    }
+    return now - besoin.derniereLivraison >= besoin.periodeMs / 100 * kAnticipationPct;
+}
+
+void ReadPlanner::livrer(Besoin& besoin, int16_t err, const byte* donnees, size_t length) {
+    uint32_t now = millis();
+    besoin.enCours = false;
+
+    if(err != RADIOLIB_ERR_NONE) {
+        if(besoin.anticipe) { // Relecture opportuniste : l'échéance normale reste due
+            return;
+        }
+        ++besoin.echecs;
+        besoin.prochainEssai = now + kReessaiMs;
+    } else {
+        besoin.demande = false;
+        besoin.derniereLivraison = now;
+    }
+
+    Callback callback = besoin.callback;  // Le rappel peut déclarer un besoin et déplacer le vecteur
+    if(callback) {
+        callback(err, donnees, length);
+    }
+}
+
+void ReadPlanner::isoler(Besoin& besoin, uint32_t now) {
+    // Refus ou silence passager (chaudière à l'arrêt, brouillage) : la fusion est retentée plus tard
+    besoin.isolementMs = besoin.isolementMs == 0 ? kIsolementMinMs : std::min(besoin.isolementMs * 2, kIsolementMaxMs);
+    besoin.isoleJusqua = (now + besoin.isolementMs) | 1;   // Jamais 0, réservé à « fusionnable »
+    besoin.echecsFusion = 0;
+}
+
+void ReadPlanner::loop() {
+    if(_besoins.empty()) {
+        return;
+    }
+
+    uint32_t now = millis();
+    std::vector<uint8_t> candidats;
+    for(size_t i = 0; i < _besoins.size(); i++) {
+        Besoin& besoin = _besoins[i];
+        if(!estDu(besoin, now)) {
+            continue;
+        }
+
+        // Zone déjà connue (écoute passive, bloc voisin, autre appareil) : pas de transaction radio
+        byte trame[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+        size_t length = 0;
+        if(_radio.memoire().lireReponse(besoin.adresse, besoin.taille, trame, length, kFraicheurMs)) {
+            debug("[RADIO] Lecture %s (0x%04X) servie par le cache mémoire.", besoin.nom, besoin.adresse);
+            ++besoin.servies;
+            besoin.anticipe = false;
+            livrer(besoin, RADIOLIB_ERR_NONE, trame, length);
+            continue;
+        }
+
+        besoin.anticipe = false;
+        candidats.push_back(i);
+    }
+
+    if(candidats.empty()) {
+        return;
+    }
+
+    // Zones voisines à plus de la moitié de leur période : relues avec les zones dues si la fusion le permet
+    for(size_t i = 0; i < _besoins.size(); i++) {
+        if(std::find(candidats.begin(), candidats.end(), i) == candidats.end() && estAnticipable(_besoins[i], now)) {
+            _besoins[i].anticipe = true;
+            candidats.push_back(i);
+        }
+    }
+
+    std::sort(candidats.begin(), candidats.end(), [this](uint8_t a, uint8_t b) {
+        return _besoins[a].adresse < _besoins[b].adresse;
+    });
+
+    // Fusion par balayage des intervalles triés, dans la limite de kBlocMaxMots
+    std::vector<uint8_t> membres;
+    uint16_t debut = 0;
+    uint16_t fin = 0;
+    for(uint8_t id : candidats) {
+        const Besoin& besoin = _besoins[id];
+        uint16_t finBesoin = besoin.adresse + besoin.taille;
+
+        if(!membres.empty() && !besoin.estIsole(now) && !_besoins[membres[0]].estIsole(now) &&
+           besoin.adresse <= fin + kEcartMaxMots && std::max(fin, finBesoin) - debut <= kBlocMaxMots) {
+            membres.push_back(id);
+            fin = std::max(fin, finBesoin);
+            continue;
+        }
+
+        if(!membres.empty()) {
+            soumettre(membres, debut, fin);
+        }
+        membres.assign(1, id);
+        debut = besoin.adresse;
+        fin = finBesoin;
+    }
+    soumettre(membres, debut, fin);
+}
+
+void ReadPlanner::soumettre(const std::vector<uint8_t>& membres, uint16_t debut, uint16_t fin) {
+    // Bloc uniquement composé de relectures opportunistes : rien à lire
+    FrisquetDevice* lecteur = nullptr;
+    for(uint8_t id : membres) {
+        if(!_besoins[id].anticipe) {
+            lecteur = _besoins[id].lecteur;
+            break;
+        }
+    }
+    if(!lecteur) {
+        return;
+    }
+
+    uint16_t taille = fin - debut;
+    for(uint8_t id : membres) {
+        _besoins[id].enCours = true;
+    }
+
+    if(membres.size() > 1) {
+        debug("[RADIO] Lecture fusionnée 0x%04X/%d : %d zones.", debut, taille, (int)membres.size());
+    }
+
+    uint32_t transaction = _radio.submitAsk(
+        lecteur->getId(),
+        ID_CHAUDIERE,
+        lecteur->getIdAssociation(),
+        lecteur->incrementIdMessage(),
+        0x01,
+        debut,
+        taille,
+        [this, membres, debut, taille](int16_t err, const byte* donnees, size_t length) {
+            const size_t entete = sizeof(RadioTrameHeader) + 1;
+            if(err == RADIOLIB_ERR_NONE && length < entete + taille * 2) {
+                err = RADIOLIB_ERR_UNKNOWN;
+            }
+
+            // Bloc fusionné refusé par la chaudière : chaque zone sera relue seule
+            bool fusion = membres.size() > 1 || taille != _besoins[membres[0]].taille;
+            uint32_t now = millis();
+            if(err == RADIOLIB_ERR_ADDRESS_NOT_FOUND && fusion) {
+                for(uint8_t id : membres) {
+                    _besoins[id].enCours = false;
+                    isoler(_besoins[id], now);
+                }
+                error("[RADIO] Lecture fusionnée 0x%04X/%d refusée, zones relues séparément pendant %d min.", debut, taille, _besoins[membres[0]].isolementMs / 60000);
+                return;
+            }
+
+            // Bloc fusionné sans réponse ou tronqué (trop long pour la chaudière ?) : après
+            // kEchecsFusionMax échecs consécutifs, chaque zone est lue seule plutôt que de
+            // réessayer le même bloc. Un report faute de budget d'émission ne compte pas.
+            bool sansReponse = err == RADIOLIB_ERR_RX_TIMEOUT || err == RADIOLIB_ERR_UNKNOWN;
+            if(fusion && (err == RADIOLIB_ERR_NONE || sansReponse)) {
+                uint32_t isolementMs = 0;
+                for(uint8_t id : membres) {
+                    Besoin& besoin = _besoins[id];
+                    if(!sansReponse) {
+                        besoin.echecsFusion = 0;
+                        besoin.isolementMs = 0;
+                        continue;
+                    }
+                    if(++besoin.echecsFusion >= kEchecsFusionMax) {
+                        isoler(besoin, now);
+                        isolementMs = besoin.isolementMs;
+                    }
+                }
+                if(isolementMs > 0) {
+                    error("[RADIO] Lecture fusionnée 0x%04X/%d sans réponse, zones relues séparément pendant %d min.", debut, taille, isolementMs / 60000);
+                }
+            }
+
+            // Découpage : chaque appareil reçoit une réponse à sa propre zone
+            byte trame[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+            for(uint8_t id : membres) {
+                Besoin& besoin = _besoins[id];
+                if(err != RADIOLIB_ERR_NONE) {
+                    livrer(besoin, err, nullptr, 0);
+                    continue;
+                }
+
+                memcpy(trame, donnees, sizeof(RadioTrameHeader));
+                trame[sizeof(RadioTrameHeader)] = (uint8_t)(besoin.taille * 2);
+                memcpy(&trame[entete], &donnees[entete + (besoin.adresse - debut) * 2], besoin.taille * 2);
+                ++besoin.lectures;
+                livrer(besoin, RADIOLIB_ERR_NONE, trame, entete + besoin.taille * 2);
+            }
+        }
+    );
+
+    if(transaction == 0) {
+        uint32_t reessai = millis() + kFilePleineMs;
+        for(uint8_t id : membres) {
+            _besoins[id].enCours = false;
+            _besoins[id].prochainEssai = reessai;
+        }
+        return;
+    }
+
+    ++_blocs;
+    _fusionnees += membres.size() - 1;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <heltec.h>
+#include <functional>
+#include <vector>
+
+class FrisquetRadio;
+class FrisquetDevice;
+
+// Planification des lectures mémoire : chaque appareil déclare les zones dont il a
+// besoin et leur période de relevé. À chaque échéance, les zones voisines (même
+// échéance, ou à plus de la moitié de leur période) sont fusionnées en un minimum
+// de lectures READ de kBlocMaxMots mots au plus ; la réponse est découpée et remise
+// à chaque appareil sous la forme d'une réponse à sa propre zone.
+class ReadPlanner {
+    public:
+        typedef std::function<void(int16_t err, const byte* donnees, size_t length)> Callback;
+
+        static constexpr uint8_t kAucun = 0xFF;
+        static constexpr uint16_t kBlocMaxMots = 0x60;      // 199 octets de réponse
+        static constexpr uint16_t kEcartMaxMots = 0x20;     // Mots inutiles lus au plus pour éviter une transaction
+        static constexpr uint8_t kAnticipationPct = 50;     // Part de la période au-delà de laquelle une zone est relue avec une voisine
+        static constexpr uint32_t kFraicheurMs = 60000;     // Zone plus récente dans le cache : servie sans lecture
+        static constexpr uint32_t kReessaiMs = 60000;       // Après un échec
+        static constexpr uint8_t kEchecsFusionMax = 2;      // Blocs fusionnés sans réponse consécutifs avant lecture isolée
+        static constexpr uint32_t kIsolementMinMs = 600000;     // Lecture isolée avant nouvel essai de fusion, doublée à chaque récidive
+        static constexpr uint32_t kIsolementMaxMs = 21600000;
+        static constexpr uint32_t kFilePleineMs = 1000;     // File de transactions pleine
+        static constexpr uint8_t kAllongementPct = 25;      // Allongement de la période après un relevé stable
+
+        struct Besoin {
+            const char* nom = nullptr;
+            FrisquetDevice* lecteur = nullptr;
+            uint16_t adresse = 0;
+            uint16_t taille = 0;
+            uint32_t periodeMs = 0;         // 0 : lecture à la demande uniquement
+            uint32_t periodeMinMs = 0;      // Bornes de la période adaptative
+            uint32_t periodeMaxMs = 0;
+            Callback callback;
+
+            bool demande = false;           // Lecture demandée explicitement
+            bool enCours = false;
+            uint32_t isoleJusqua = 0;       // Refusée ou sans réponse dans un bloc fusionné : lue seule jusqu'à ce millis(), 0 sinon
+            uint32_t isolementMs = 0;       // Durée du dernier isolement, remise à zéro par une lecture fusionnée réussie
+            bool anticipe = false;          // Relue avant échéance, avec une zone voisine
+            uint32_t derniereLivraison = 0; // millis() de la dernière livraison
+            uint32_t prochainEssai = 0;
+
+            uint32_t lectures = 0;          // Livrées par une lecture radio
+            uint32_t servies = 0;           // Livrées par le cache
+            uint32_t echecs = 0;
+            uint8_t echecsFusion = 0;       // Blocs fusionnés consécutifs sans réponse
+
+            bool estIsole(uint32_t now) const { return isoleJusqua != 0 && (int32_t)(now - isoleJusqua) < 0; }
+            uint32_t repriseFusionMs(uint32_t now) const { return estIsole(now) ? isoleJusqua - now : 0; }
+        };
+
+        explicit ReadPlanner(FrisquetRadio& radio) : _radio(radio) {}
+
+        // Zone lue avec l'identité de lecteur ; retourne l'identifiant du besoin
+        uint8_t declarer(const char* nom, FrisquetDevice& lecteur, uint16_t adresse, uint16_t taille, uint32_t periodeMs, Callback callback);
+
+        // Lecture immédiate (démarrage, relevé forcé), servie par le cache si possible
+        bool demander(uint8_t besoin);
+
+        // Période adaptative : divisée par deux quand le relevé montre des valeurs qui bougent
+        // (brûleur en marche, pression qui varie), allongée de kAllongementPct quand elles sont
+        // stables, sans sortir des bornes
+        void bornerPeriode(uint8_t besoin, uint32_t periodeMinMs, uint32_t periodeMaxMs);
+        void signalerVariation(uint8_t besoin, bool variation);
+
+        // Échéances, fusion et soumission des lectures : à appeler à chaque tour de boucle
+        void loop();
+
+        const std::vector<Besoin>& besoins() const { return _besoins; }
+        uint32_t getBlocs() const { return _blocs; }
+        uint32_t getFusionnees() const { return _fusionnees; }
+
+    private:
+        bool estDu(const Besoin& besoin, uint32_t now) const;
+        bool estAnticipable(const Besoin& besoin, uint32_t now) const;
+        void livrer(Besoin& besoin, int16_t err, const byte* donnees, size_t length);
+        void isoler(Besoin& besoin, uint32_t now);
+        void soumettre(const std::vector<uint8_t>& membres, uint16_t debut, uint16_t fin);
+
+        FrisquetRadio& _radio;
+        std::vector<Besoin> _besoins;
+
+        uint32_t _blocs = 0;            // Lectures radio soumises
+        uint32_t _fusionnees = 0;       // Zones lues dans le bloc d'une autre
+};
@@ -0,0 +1,140 @@
+#include "ReplyInterceptor.h"
+#include "../Logs.h"
+
+bool ReplyInterceptor::armer(
+    uint8_t idExpediteur,
+    uint8_t idDestinataire,
+    uint8_t idMessage,
+    uint8_t idReception,
+    uint8_t type,
+    uint32_t requeteUs,
+    Callback callback
+) {
+    Fenetre* libre = nullptr;
+    for(Fenetre& fenetre : _fenetres) {
+        if(!fenetre.active) {
+            libre = &fenetre;
+            break;
+        }
+    }
+    if(!libre) {
+        ++_stats.saturees;
+        return false;
+    }
+
+    libre->active = true;
+    libre->idExpediteur = idExpediteur;
+    libre->idDestinataire = idDestinataire;
+    libre->idMessage = idMessage;
+    libre->idReception = idReception;
+    libre->type = type;
+    libre->requeteUs = requeteUs;
+    libre->dureeUs = fenetreMs() * 1000;
+    libre->callback = callback;
+    ++_stats.armees;
+    return true;
+}
+
+bool ReplyInterceptor::onFrame(const RadioFrame& frame) {
+    if(frame.length < sizeof(RadioTrameHeader)) {
+        return false;
+    }
+
+    RadioTrameHeader header;
+    memcpy(&header, frame.data, sizeof(header));
+
+    for(Fenetre& fenetre : _fenetres) {
+        if(!fenetre.active || header.idExpediteur != fenetre.idExpediteur || header.idDestinataire != fenetre.idDestinataire) {
+            continue;
+        }
+
+        // Délai mesuré entre les deux interruptions : indépendant de la charge de la boucle
+        uint32_t delaiUs = frame.timestamp - fenetre.requeteUs;
+        if(delaiUs > fenetre.dureeUs) {
+            continue;
+        }
+
+        // Réponse ou REFUS : l'en-tête reprend celui de la requête
+        if(header.idMessage != fenetre.idMessage || header.idReception != fenetre.idReception) {
+            continue;
+        }
+
+        int16_t err;
+        if(header.type == fenetre.type) {
+            err = RADIOLIB_ERR_NONE;
+            ++_stats.recues;
+            mesurer(delaiUs);
+        } else if(header.type == RadioMessageType::REFUS) {
+            err = RADIOLIB_ERR_ADDRESS_NOT_FOUND;
+            ++_stats.refusees;
+        } else {
+            continue;
+        }
+
+        // Libérée avant le rappel : il peut armer une nouvelle fenêtre
+        Callback callback = std::move(fenetre.callback);
+        fenetre.active = false;
+        fenetre.callback = nullptr;
+        if(callback) {
+            callback(err, frame.data, frame.length);
+        }
+        return true;
+    }
+    return false;
+}
+
+void ReplyInterceptor::loop() {
+    uint32_t now = micros();
+    for(Fenetre& fenetre : _fenetres) {
+        if(!fenetre.active || now - fenetre.requeteUs <= fenetre.dureeUs + kDelaiTraitementMs * 1000) {
+            continue;
+        }
+
+        // Réponse manquée : la fenêtre suivante est élargie jusqu'à la prochaine mesure
+        ++_stats.expirees;
+        if(_expirationsConsecutives < 4) {
+            ++_expirationsConsecutives;
+        }
+        debug("[RADIO] Aucune réponse de 0x%02X dans la fenêtre de %d ms.", fenetre.idExpediteur, fenetre.dureeUs / 1000);
+
+        Callback callback = std::move(fenetre.callback);
+        fenetre.active = false;
+        fenetre.callback = nullptr;
+        if(callback) {
+            callback(RADIOLIB_ERR_RX_TIMEOUT, nullptr, 0);
+        }
+    }
+}
+
+void ReplyInterceptor::mesurer(uint32_t delaiUs) {
+    _expirationsConsecutives = 0;
+
+    size_t classe = delaiUs / 1000 / kClasseMs;
+    ++_histogramme[classe < kClasses ? classe : kClasses - 1];
+
+    if(_echantillons++ == 0) {
+        _moyenneUs = delaiUs;
+        _ecartUs = delaiUs / 2;
+        return;
+    }
+
+    uint32_t ecart = delaiUs > _moyenneUs ? delaiUs - _moyenneUs : _moyenneUs - delaiUs;
+    _ecartUs = (_ecartUs * 3 + ecart) / 4;
+    _moyenneUs = (_moyenneUs * 7 + delaiUs) / 8;
+}
+
+uint32_t ReplyInterceptor::fenetreMs() const {
+    uint32_t fenetre = kFenetreDefautMs;
+    if(_echantillons >= kEchantillonsMin) {
+        fenetre = (_moyenneUs + 4 * _ecartUs) / 1000;
+    }
+    fenetre <<= _expirationsConsecutives;
+
+    if(fenetre < kFenetreMinMs) {
+        return kFenetreMinMs;
+    }
+    if(fenetre > kFenetreMaxMs) {
+        return kFenetreMaxMs;
+    }
+    return fenetre;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <heltec.h>
+#include <functional>
+#include "RadioFrameQueue.h"
+#include "Trames.h"
+
+// Écoute passive des réponses de la chaudière aux requêtes des appareils physiques
+// (satellites, Connect) : à chaque requête interceptée, une fenêtre de réception est
+// armée pour la réponse attendue. Sa durée suit le délai de réponse mesuré de la
+// chaudière (moyenne lissée + 4 écarts, comme un RTO TCP) ; la réponse est remise
+// au rappel sans bloquer la boucle principale.
+class ReplyInterceptor {
+    public:
+        typedef std::function<void(int16_t err, const byte* donnees, size_t length)> Callback;
+
+        static constexpr size_t kMaxFenetres = 4;
+        static constexpr uint32_t kFenetreMinMs = 150;
+        static constexpr uint32_t kFenetreMaxMs = 2000;
+        static constexpr uint32_t kFenetreDefautMs = 1500;   // Tant que le modèle n'est pas établi
+        static constexpr uint8_t kEchantillonsMin = 3;
+        static constexpr uint32_t kDelaiTraitementMs = 100;   // Trame reçue dans la fenêtre mais pas encore dépilée
+
+        static constexpr uint32_t kClasseMs = 50;             // Histogramme des délais de réponse
+        static constexpr size_t kClasses = 21;                // 20 classes de 50 ms, puis au-delà d'1 s
+
+        struct Stats {
+            uint32_t armees = 0;
+            uint32_t recues = 0;
+            uint32_t refusees = 0;      // Réponse REFUS de la chaudière
+            uint32_t expirees = 0;
+            uint32_t saturees = 0;      // Aucune fenêtre libre
+        };
+
+        // Arme une fenêtre pour la réponse à une requête reçue à requeteUs (horodatage
+        // de l'interruption). Le rappel reçoit la réponse, RADIOLIB_ERR_RX_TIMEOUT à la
+        // fermeture de la fenêtre ou RADIOLIB_ERR_ADDRESS_NOT_FOUND sur refus.
+        bool armer(
+            uint8_t idExpediteur,
+            uint8_t idDestinataire,
+            uint8_t idMessage,
+            uint8_t idReception,
+            uint8_t type,
+            uint32_t requeteUs,
+            Callback callback
+        );
+
+        // Appelé pour chaque trame dépilée, true si elle répond à une fenêtre armée
+        bool onFrame(const RadioFrame& frame);
+
+        // Fermeture des fenêtres échues : à appeler à chaque tour de boucle
+        void loop();
+
+        // Durée de la prochaine fenêtre selon le modèle
+        uint32_t fenetreMs() const;
+        uint32_t moyenneMs() const { return _moyenneUs / 1000; }
+        uint32_t ecartMs() const { return _ecartUs / 1000; }
+        uint32_t echantillons() const { return _echantillons; }
+        uint32_t classe(size_t i) const { return i < kClasses ? _histogramme[i] : 0; }
+        const Stats& stats() const { return _stats; }
+
+    private:
+        struct Fenetre {
+            bool active = false;
+            uint8_t idExpediteur = 0x00;
+            uint8_t idDestinataire = 0x00;
+            uint8_t idMessage = 0x00;
+            uint8_t idReception = 0x00;
+            uint8_t type = 0x00;
+            uint32_t requeteUs = 0;
+            uint32_t dureeUs = 0;
+            Callback callback;
+        };
+
+        void mesurer(uint32_t delaiUs);
+
+        Fenetre _fenetres[kMaxFenetres];
+
+        uint32_t _moyenneUs = 0;
+        uint32_t _ecartUs = 0;
+        uint32_t _echantillons = 0;
+        uint8_t _expirationsConsecutives = 0;
+        uint32_t _histogramme[kClasses] = {0};
+        Stats _stats;
+};
@@ -1,6 +1,7 @@
 #include "Satellite.h"
 #include <math.h>
 #include "../Buffer.h"
+#include "Schemas.h"
 
 void Satellite::loadConfig() {
     getPreferences().begin((String("satCfgZ") + String(getNumeroZone())).c_str(), false);
@@ -71,21 +72,25 @@ void Satellite::loop() {
 
     if(firstLoop) {
         recupererInfosChaudiere();
-        publishMqtt();
-        _zone.publishMqtt();
         firstLoop = false;
     }
 
-    if ((_zone.getLastChange() > _zone.getLastEnvoi() && (_zone.getLastChange() + 15000) < now ) || now - _lastEnvoiConsigne >= 600000  ) { // dernier changement ou 10 minutes
+    // Changement : envoi 15 s après ; rafraîchissement toutes les 10 minutes dans un créneau calme
+    if ((_zone.getLastChange() > _zone.getLastEnvoi() && (_zone.getLastChange() + 15000) < now ) || relevePret(_lastEnvoiConsigne, 600000)) { // dernier changement ou 10 minutes
         info("[SATELLITE Z%d] Envoi de la consigne.", getNumeroZone());
         _zone.refreshLastEnvoi();
-        if(envoyerConsigne()) {
-            incrementIdMessage(3);
-            _lastEnvoiConsigne = now;
-            _zone.publishMqtt();
-            publishMqtt();
-        } else {
-            error("[SATELLITE Z%d] Echec de l'envoi.", getNumeroZone());
+        _lastEnvoiConsigne = now;
+        bool soumis = envoyerConsigne([this, now](bool ok) {
+            if(ok) {
+                incrementIdMessage(3);
+                _zone.publishMqtt();
+                publishMqtt();
+            } else {
+                error("[SATELLITE Z%d] Echec de l'envoi.", getNumeroZone());
+                _lastEnvoiConsigne = now <= 60000 ? 1 : now - 60000;
+            }
+        });
+        if(!soumis) {
             _lastEnvoiConsigne = now <= 60000 ? 1 : now - 60000;
         }
     }
@@ -103,64 +108,26 @@ bool Satellite::recupererInfosChaudiere() {
         return false;
     }
 
-    struct donneesZones_t {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueur;
-        temperature16 temperatureExterieure;
-        byte i1[2];
-        uint8_t date[6];  // format reçu "YY MM DD hh mm ss"
-        byte etatChaudiere; // mode chaudière à valider 0X20 Hors gel 0x24 = Hors gel contact sec 0X28 = Fonctionnement
-        uint8_t jourSemaine; // format wday
-        temperature16 temperatureAmbianteZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i2 = 0x00;
-        uint8_t modeZ1 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i3[4] = {0x00, 0xC6, 0x00, 0xC6};
-        temperature16 temperatureAmbianteZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i4 = 0x00;
-        uint8_t modeZ2 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i5[4] = {0x00, 0x00, 0x00, 0x00};
-        temperature16 temperatureAmbianteZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i6 = 0x00;
-        uint8_t modeZ3 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i7[4] = {0x00, 0x00, 0x00, 0x00};
-    } donneesZones;
-
-    size_t length = 0;
-    int16_t err;
-
-    info("[Satellite %d] Récupération des informations chaudière.", _zone.getNumeroZone());
-    
-    uint8_t retry = 0;
-    do {
-        length = sizeof(donneesZones_t);
-        err = this->radio().sendAsk(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01,
-            0xA029,
-            0x0015,
-            (byte*)&donneesZones,
-            length
-        );
-        
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(30);
-            continue;
+    auto traiterInfos = [this](const byte* donnees, size_t length) {
+        const SchemaSatellites* satellites = vueTrame<SchemaSatellites>(donnees, length);
+        if(!satellites) {
+            return false;
         }
 
-        setEtatChaudiere(donneesZones.etatChaudiere);
-        Date date = donneesZones.date;
-        setDate(date);
-        
+        setEtatChaudiere(satellites->etatChaudiere);
+        setDate(Date(satellites->date));
+        publishMqtt();
+        _zone.publishMqtt();
         return true;
-    } while(retry++ < 1);
+    };
 
-    return false;
+    // Bloc servi par le cache s'il a été relevé récemment (interception du satellite physique, autre zone)
+    info("[Satellite %d] Récupération des informations chaudière.", _zone.getNumeroZone());
+    return lirePlanifie(_besoinInfos, "infos satellite", SchemaSatellites::adresse, SchemaSatellites::taille, [this, traiterInfos](int16_t err, const byte* donnees, size_t length) {
+        if(err != RADIOLIB_ERR_NONE || !traiterInfos(donnees, length)) {
+            error("[SATELLITE Z%d] Échec de la récupération des informations chaudière.", getNumeroZone());
+        }
+    });
 }
 
 bool Satellite::envoyerTemperatureAmbiante() {
@@ -177,74 +144,39 @@ bool Satellite::envoyerTemperatureAmbiante() {
         temperature16 temperatureAmbiante;
     } payload;
 
-    struct donneesZones_t {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueur;
-        temperature16 temperatureExterieure;
-        byte i1[2];
-        uint8_t date[6];  // format reçu "YY MM DD hh mm ss"
-        byte etatChaudiere; // mode chaudière à valider 0X20 Hors gel 0x24 = Hors gel contact sec 0X28 = Fonctionnement
-        uint8_t jourSemaine; // format wday
-        temperature16 temperatureAmbianteZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i2 = 0x00;
-        uint8_t modeZ1 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i3[4] = {0x00, 0xC6, 0x00, 0xC6};
-        temperature16 temperatureAmbianteZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i4 = 0x00;
-        uint8_t modeZ2 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i5[4] = {0x00, 0x00, 0x00, 0x00};
-        temperature16 temperatureAmbianteZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i6 = 0x00;
-        uint8_t modeZ3 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i7[4] = {0x00, 0x00, 0x00, 0x00};
-    } donneesZones;
-
-    
     payload.temperatureAmbiante = _zone.getTemperatureAmbiante();
 
-    size_t length = 0;
-    int16_t err;
-
     info("[Satellite %d] Envoi de la température ambiante %0.2f", _zone.getNumeroZone(), payload.temperatureAmbiante.toFloat());
-    
-    uint8_t retry = 0;
-    do {
-        length = sizeof(donneesZones_t);
-        err = this->radio().sendInit(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01, 
-            0xA029,
-            0x0015,
-            0xA02F + (0x0005 * (getNumeroZone() - 1)),
-            0x0001,
-            (byte*)&payload,
-            sizeof(payload),
-            (byte*)&donneesZones,
-            length
-        );
-        
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(30);
-            continue;
-        }
 
-        setEtatChaudiere(donneesZones.etatChaudiere);
-        Date date = donneesZones.date;
-        setDate(date);
-        
-        return true;
-    } while(retry++ < 1);
+    // Relances confiées au moteur de transactions, réponse traitée depuis FrisquetManager::loop
+    uint32_t id = this->radio().submitInit(
+        this->getId(), 
+        ID_CHAUDIERE, 
+        this->getIdAssociation(),
+        this->incrementIdMessage(),
+        0x01, 
+        SchemaSatellites::adresse,
+        SchemaSatellites::taille,
+        SchemaSatellites::adresseZone(getNumeroZone()),
+        0x0001,
+        (byte*)&payload,
+        sizeof(payload),
+        [this](int16_t err, const byte* donnees, size_t length) {
+            const SchemaSatellites* satellites = vueTrame<SchemaSatellites>(donnees, length);
+            if(err != RADIOLIB_ERR_NONE || !satellites) {
+                error("[SATELLITE Z%d] Échec de l'envoi de la température ambiante.", getNumeroZone());
+                return;
+            }
 
-    return false;
+            setEtatChaudiere(satellites->etatChaudiere);
+            setDate(Date(satellites->date));
+        }
+    );
+
+    return id != 0;
 }
 
-bool Satellite::envoyerConsigne() {
+bool Satellite::envoyerConsigne(std::function<void(bool)> callback) {
     if(! estAssocie() || getNumeroZone() == 0) {
         return false;
     }
@@ -254,39 +186,7 @@ bool Satellite::envoyerConsigne() {
         return false;
     }
 
-    struct donneesSatellite_t {
-        temperature16 temperatureAmbiante;
-        temperature16 temperatureConsigne;
-        uint8_t i1 = 0x00; 
-        uint8_t mode = 0x00; // 0x01 Confort, 0x02 Reduit, etc.
-        fword options = (uint16_t)0x0000;
-    } payload;
-
-    struct donneesZones_t {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueur;
-        temperature16 temperatureExterieure;
-        byte i1[2];
-        uint8_t date[6];  // format reçu "YY MM DD hh mm ss"
-        byte etatChaudiere; // mode chaudière à valider 0X20 Hors gel 0x24 = Hors gel contact sec 0X28 = Fonctionnement
-        uint8_t jourSemaine; // format wday
-        temperature16 temperatureAmbianteZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i2 = 0x00;
-        uint8_t modeZ1 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i3[4] = {0x00, 0xC6, 0x00, 0xC6};
-        temperature16 temperatureAmbianteZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i4 = 0x00;
-        uint8_t modeZ2 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i5[4] = {0x00, 0x00, 0x00, 0x00};
-        temperature16 temperatureAmbianteZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        temperature16 temperatureConsigneZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-        byte i6 = 0x00;
-        uint8_t modeZ3 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-        byte i7[4] = {0x00, 0x00, 0x00, 0x00};
-    } donneesZones;
-
+    SchemaConsigneSatellite payload;
     
     payload.temperatureAmbiante = _zone.getTemperatureAmbiante();
     payload.temperatureConsigne = _zone.getTemperatureConsigne();
@@ -330,45 +230,42 @@ bool Satellite::envoyerConsigne() {
         payload.temperatureConsigne = isnan(_zone.getTemperatureHorsGel()) ? 8.0f : _zone.getTemperatureHorsGel();
     } 
     
-    size_t length = 0;
-    int16_t err;
-
     info("[Satellite %d] Envoi de la consigne %0.2f, amb %0.2f, mode %s %d.", _zone.getNumeroZone(), payload.temperatureConsigne.toFloat(), _zone.getTemperatureAmbiante(), _zone.getNomMode(), payload.mode);
-    
-    uint8_t retry = 0;
-    do {
-        length = sizeof(donneesZones_t);
-        err = this->radio().sendInit(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01, 
-            0xA029,
-            0x0015,
-            0xA02F + (0x0005 * (getNumeroZone() - 1)),
-            0x0004,
-            (byte*)&payload,
-            sizeof(payload),
-            (byte*)&donneesZones,
-            length
-        );
-        
-        if(err != RADIOLIB_ERR_NONE) {
-            delay(30);
-            continue;
-        }
 
-        setEtatChaudiere(donneesZones.etatChaudiere);
-        debug("[SATELLITE Z%d] Retour état chaudière : 0x%02X", getNumeroZone(), donneesZones.etatChaudiere);
-        debug("[SATELLITE Z%d] Retour état chaudière : %s", getNumeroZone(), getEtatChaudiere().getLibelle().c_str());
-        Date date = donneesZones.date;
-        setDate(date);
-        
-        return true;
-    } while(retry++ < 1);
+    uint32_t id = this->radio().submitInit(
+        this->getId(), 
+        ID_CHAUDIERE, 
+        this->getIdAssociation(),
+        this->incrementIdMessage(),
+        0x01, 
+        SchemaSatellites::adresse,
+        SchemaSatellites::taille,
+        SchemaSatellites::adresseZone(getNumeroZone()),
+        0x0004,
+        (byte*)&payload,
+        sizeof(payload),
+        [this, callback](int16_t err, const byte* donnees, size_t length) {
+            const SchemaSatellites* satellites = vueTrame<SchemaSatellites>(donnees, length);
+            if(err != RADIOLIB_ERR_NONE || !satellites) {
+                if(callback) {
+                    callback(false);
+                }
+                return;
+            }
 
-    return false;
+            setEtatChaudiere(satellites->etatChaudiere);
+            debug("[SATELLITE Z%d] Retour état chaudière : 0x%02X", getNumeroZone(), satellites->etatChaudiere);
+            debug("[SATELLITE Z%d] Retour état chaudière : %s", getNumeroZone(), getEtatChaudiere().getLibelle().c_str());
+            setDate(Date(satellites->date));
+
+            if(callback) {
+                callback(true);
+            }
+        },
+        DutyCycle::PRIORITE::UTILISATEUR
+    );
+
+    return id != 0;
 }
 
 bool Satellite::onReceive(byte* donnees, size_t length) { 
@@ -381,113 +278,45 @@ bool Satellite::onReceive(byte* donnees, size_t length) {
             FrisquetRadio::RadioTrameInit* requete = (FrisquetRadio::RadioTrameInit*) readBuffer.getBytes(sizeof(FrisquetRadio::RadioTrameInit));
             if(requete->adresseMemoireEcriture.toUInt16() == 0xA02F && requete->tailleMemoireEcriture.toUInt16() == 0x0004) { // Envoi consigne
 
-                struct donneesSatellite_t {
-                    temperature16 temperatureAmbiante; 
-                    temperature16 temperatureConsigne;
-                    uint8_t i1 = 0x00; 
-                    uint8_t mode = 0x00; // 0x01 Confort, 0x02 Reduit, etc.
-                    uint8_t i2[2] = {0};
-                }* donneesSatellite = (donneesSatellite_t*) readBuffer.getBytes(sizeof(*donneesSatellite));
+                const SchemaConsigneSatellite consigne = *(const SchemaConsigneSatellite*) readBuffer.getBytes(sizeof(SchemaConsigneSatellite));
                 
                 //info("[SATELLITE Z%d] Interception envoi consigne.", getNumeroZone());
+                radio().memoire().enregistrer(requete->adresseMemoireEcriture.toUInt16(), (const byte*)&consigne, sizeof(consigne) / 2, BoilerMemoryMap::SOURCE::ECOUTE_PASSIVE);
 
-                uint8_t retry = 0;
-                int16_t err;
-                
-                size_t lengthRx = 0;
-                byte buffZones[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-
-                if(! getEcrasement()) {
-                    delay(300);
-
-                    err = radio().receiveExpected(
-                        ID_CHAUDIERE,
-                        this->getId(),
-                        header->idAssociation, 
-                        header->idMessage,
-                        header->idReception|0x80,
-                        header->type,
-                        (byte*) buffZones,
-                        lengthRx,
-                        15, true
-                    );
-                    
-                    if(err != RADIOLIB_ERR_NONE) {
-                        return false;
-                    }
-
-                    readBuffer = ReadBuffer(buffZones, lengthRx);
-
-                    struct donneesZones_t {
-                        FrisquetRadio::RadioTrameHeader header;
-                        uint8_t longueur;
-                        temperature16 temperatureExterieure;
-                        byte i1[2];
-                        uint8_t date[6];  // format reçu "YY MM DD hh mm ss"
-                        byte etatChaudiere; // mode chaudière à valider
-                        uint8_t jourSemaine; // format wday
-                        temperature16 temperatureAmbianteZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        temperature16 temperatureConsigneZ1;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        byte i2 = 0x00;
-                        uint8_t modeZ1 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-                        byte i3[4] = {0x00, 0xC6, 0x00, 0xC6};
-                        temperature16 temperatureAmbianteZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        temperature16 temperatureConsigneZ2;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        byte i4 = 0x00;
-                        uint8_t modeZ2 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-                        byte i5[4] = {0x00, 0x00, 0x00, 0x00};
-                        temperature16 temperatureAmbianteZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        temperature16 temperatureConsigneZ3;    // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
-                        byte i6 = 0x00;
-                        uint8_t modeZ3 = 0x00;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
-                        byte i7[4] = {0x00, 0x00, 0x00, 0x00};
-                    }* donneesZones = (donneesZones_t*)readBuffer.getBytes(sizeof(donneesZones_t));
-
-                    if(lengthRx < sizeof(donneesZones_t)) {
-                        return false;
-                    }
-
-                    setEtatChaudiere(donneesZones->etatChaudiere);
-                    Date date = donneesZones->date;
-                    setDate(date);
-                }
+                uint8_t idAssociation = header->idAssociation;
+                uint8_t idMessage = header->idMessage;
 
-                setIdAssociation(header->idAssociation);
-                setIdMessage(header->idMessage);
-                _zone.setTemperatureAmbiante(donneesSatellite->temperatureAmbiante.toFloat());
-                
-                if(! getEcrasement()) {
-                    setMode((MODE)donneesSatellite->mode);
-                    _zone.setTemperatureConsigne(donneesSatellite->temperatureConsigne.toFloat());
-                    saveConfig();
-                    _zone.saveConfig();
-                    publishMqtt();
-                    _zone.publishMqtt();
+                if(getEcrasement()) {
+                    appliquerConsigne(idAssociation, idMessage, consigne);
                     return true;
                 }
 
-                if(getMode() == MODE::INCONNU) {
-                    setMode((MODE)donneesSatellite->mode);
-                }
-                if(isnan(_zone.getTemperatureConsigne())) {
-                    _zone.setTemperatureConsigne(donneesSatellite->temperatureConsigne.toFloat());
-                }
-
-                info("[SATELLITE Z%d] Écrasement de données.", getNumeroZone());
-
-                incrementIdMessage(3);
-
-                if(!this->envoyerConsigne()) {
-                    error("[SATELLITE Z%d] Échec de l'écrasement.", getNumeroZone());
-                } else {
-                    info("[SATELLITE Z%d] Écrasement réussie.", getNumeroZone());
-                }
-
-                saveConfig();
-                _zone.saveConfig();
-                publishMqtt();
-                _zone.publishMqtt();
-                return true;
+                // Réponse de la chaudière (zones, état, date) attendue dans la fenêtre modélisée
+                uint16_t adresseLecture = requete->adresseMemoireLecture.toUInt16();
+                uint16_t tailleLecture = requete->tailleMemoireLecture.toUInt16();
+                return radio().interceptions().armer(
+                    ID_CHAUDIERE,
+                    this->getId(),
+                    idMessage,
+                    header->idReception|0x80,
+                    header->type,
+                    radio().horodatageReception(),
+                    [this, idAssociation, idMessage, consigne, adresseLecture, tailleLecture](int16_t err, const byte* donnees, size_t length) {
+                        if(err != RADIOLIB_ERR_NONE) {
+                            return;
+                        }
+
+                        radio().memoire().enregistrerReponse(adresseLecture, tailleLecture, donnees, length, BoilerMemoryMap::SOURCE::ECOUTE_PASSIVE);
+                        const SchemaSatellites* satellites = vueTrame<SchemaSatellites>(donnees, length);
+                        if(!satellites) {
+                            return;
+                        }
+
+                        setEtatChaudiere(satellites->etatChaudiere);
+                        setDate(Date(satellites->date));
+                        appliquerConsigne(idAssociation, idMessage, consigne);
+                    }
+                );
             }
         }
     } else {
@@ -502,6 +331,51 @@ bool Satellite::onReceive(byte* donnees, size_t length) {
     return false;
 }
 
+void Satellite::appliquerConsigne(uint8_t idAssociation, uint8_t idMessage, const SchemaConsigneSatellite& consigne) {
+    setIdAssociation(idAssociation);
+    setIdMessage(idMessage);
+    _zone.setTemperatureAmbiante(consigne.temperatureAmbiante.toFloat());
+    
+    if(! getEcrasement()) {
+        setMode((MODE)consigne.mode);
+        _zone.setTemperatureConsigne(consigne.temperatureConsigne.toFloat());
+        persisterEtPublier();
+        return;
+    }
+
+    if(getMode() == MODE::INCONNU) {
+        setMode((MODE)consigne.mode);
+    }
+    if(isnan(_zone.getTemperatureConsigne())) {
+        _zone.setTemperatureConsigne(consigne.temperatureConsigne.toFloat());
+    }
+
+    incrementIdMessage(3);
+
+    this->envoyerConsigne([this](bool ok) {
+        if(!ok) {
+            error("[SATELLITE Z%d] Échec de l'écrasement.", getNumeroZone());
+        } else {
+            info("[SATELLITE Z%d] Écrasement réussie.", getNumeroZone());
+        }
+    });
+
+    radio().travaux().differer([this]() {
+        info("[SATELLITE Z%d] Écrasement de données.", getNumeroZone());
+    });
+    persisterEtPublier();
+}
+
+void Satellite::persisterEtPublier() {
+    // Hors du chemin de réception : écritures NVS et publications après le retour en réception
+    radio().travaux().differer([this]() {
+        saveConfig();
+        _zone.saveConfig();
+        publishMqtt();
+        _zone.publishMqtt();
+    });
+}
+
 String Satellite::getNomMode() {
     switch(this->getMode()) {
         case MODE::CONFORT_AUTO:
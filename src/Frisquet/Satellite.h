@@ -5,6 +5,8 @@
 #include "Logs.h"
 #include "Zone.h"
 
+struct SchemaConsigneSatellite;
+
 class Satellite : public FrisquetDevice {
     
     public:
@@ -57,11 +59,11 @@ class Satellite : public FrisquetDevice {
         void begin(bool modeVirtuel = false);
         void publishMqtt();
 
-        bool envoyerConsigne();
+        bool envoyerConsigne(std::function<void(bool)> callback = nullptr);
         bool envoyerTemperatureAmbiante();
         bool recupererInfosChaudiere();
 
-        bool onReceive(byte* donnees, size_t length);
+        bool onReceive(byte* donnees, size_t length) override;
 
         MODE getMode();
         void setMode(MODE mode);
@@ -78,9 +80,14 @@ class Satellite : public FrisquetDevice {
         }
 
     private:
+        // Consigne interceptée (satellite physique) : reprise ou écrasée selon la configuration
+        void appliquerConsigne(uint8_t idAssociation, uint8_t idMessage, const SchemaConsigneSatellite& consigne);
+        void persisterEtPublier();
+
         Zone& _zone;
 
         uint32_t _lastEnvoiConsigne = 0;
+        uint8_t _besoinInfos = ReadPlanner::kAucun;
         bool _modeVirtuel = false;
         bool _ecrasement = false;
         ETAT_CHAUDIERE _etatChaudiere;
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stddef.h>
+#include "Utils.h"
+
+// Disposition des zones mémoire échangées avec la chaudière : une seule définition
+// par zone, vérifiée à la compilation. Les champs ne contiennent que des octets
+// (alignement 1), les réponses sont donc lues en place dans le buffer de réception.
+
+// Position d'un mot mémoire dans une trame de réponse (en-tête + octet de longueur)
+constexpr size_t offsetMot(uint16_t adresseBase, uint16_t adresse) {
+    return sizeof(RadioTrameHeader) + 1 + (adresse - adresseBase) * 2;
+}
+
+// Vue sans copie d'une réponse : nullptr si la trame est trop courte pour le schéma
+template<typename Schema>
+const Schema* vueTrame(const byte* trame, size_t length) {
+    static_assert(alignof(Schema) == 1, "Un schéma de trame ne doit contenir que des octets");
+    static_assert(sizeof(Schema) == offsetMot(Schema::adresse, Schema::adresse + Schema::taille), "Taille du schéma incohérente avec la zone mémoire");
+    return length < sizeof(Schema) ? nullptr : reinterpret_cast<const Schema*>(trame);
+}
+
+// Réponse 0xA029 / 0x0015 : extérieure, date, état chaudière et zones des satellites
+struct SchemaSatellites {
+    static constexpr uint16_t adresse = 0xA029;
+    static constexpr uint16_t taille = 0x0015;
+
+    struct Zone {
+        temperature16 temperatureAmbiante;  // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
+        temperature16 temperatureConsigne;  // Début 5°C -> 0 = 50 = 5°C - MAX 30°C
+        byte i1;
+        uint8_t mode;                       // 0x05 auto - 0x06 confort - 0x07 reduit - 0x08 hors gel
+        byte i2[4];
+    };
+
+    RadioTrameHeader header;
+    uint8_t longueur;
+    temperature16 temperatureExterieure;
+    byte i1[2];
+    uint8_t date[6];            // format reçu "YY MM DD hh mm ss"
+    byte etatChaudiere;         // 0x20 Hors gel - 0x24 Hors gel contact sec - 0x28 Fonctionnement
+    uint8_t jourSemaine;        // format wday
+    Zone zones[3];              // Zone n en 0xA02F + 0x0005 * (n - 1)
+
+    static constexpr uint16_t adresseZone(uint8_t numeroZone) {
+        return 0xA02F + 0x0005 * (numeroZone - 1);
+    }
+};
+static_assert(offsetof(SchemaSatellites, date) == offsetMot(0xA029, 0xA02B), "Date attendue en 0xA02B");
+static_assert(offsetof(SchemaSatellites, etatChaudiere) == offsetMot(0xA029, 0xA02E), "État chaudière attendu en 0xA02E");
+static_assert(offsetof(SchemaSatellites, zones) == offsetMot(0xA029, 0xA02F), "Zones attendues en 0xA02F");
+static_assert(sizeof(SchemaSatellites::Zone) == 0x0005 * 2, "Une zone satellite occupe 5 mots");
+
+// Écriture satellite en 0xA02F + 0x0005 * (zone - 1) : ambiance, consigne et mode
+struct SchemaConsigneSatellite {
+    temperature16 temperatureAmbiante;
+    temperature16 temperatureConsigne;
+    uint8_t i1 = 0x00;
+    uint8_t mode = 0x00;        // Satellite::MODE
+    fword options = (uint16_t)0x0000;
+};
+static_assert(sizeof(SchemaConsigneSatellite) == 0x0004 * 2, "Consigne satellite sur 4 mots");
+
+// Réponse 0x79E0 (0x7AA8 pour une chaudière 0x84) / 0x001C : températures et pression
+struct SchemaInformations {
+    static constexpr uint16_t adresse = 0x79E0;
+    static constexpr uint16_t taille = 0x001C;
+
+    RadioTrameHeader header;
+    uint8_t longueurDonnees;
+    temperature16 temperatureECS;
+    temperature16 temperatureCDC;
+    temperature16 temperatureDepartZ1;
+    temperature16 temperatureDepartZ2;
+    temperature16 temperatureDepartZ3;
+    temperature16 temperatureInconnue1;
+    temperature16 temperatureInconnue2;
+    temperature16 temperatureInconnue3;
+    temperature16 temperatureInconnue4;
+    temperature16 temperatureInconnue5;
+    pression16 pression;
+    byte i1[1];
+    byte modeECS;
+    temperature16 temperatureECSInstant;
+    byte i2[10];
+    temperature16 temperatureAmbianteZ1;
+    temperature16 temperatureAmbianteZ2;
+    temperature16 temperatureAmbianteZ3;
+    byte i3[6];
+    temperature16 temperatureConsigneZ1;
+    temperature16 temperatureConsigneZ2;
+    temperature16 temperatureConsigneZ3;
+    temperature16 temperatureExterieure;
+};
+static_assert(offsetof(SchemaInformations, pression) == offsetMot(0x79E0, 0x79EA), "Pression attendue en 0x79EA");
+static_assert(offsetof(SchemaInformations, temperatureAmbianteZ1) == offsetMot(0x79E0, 0x79F2), "Ambiances attendues en 0x79F2");
+static_assert(offsetof(SchemaInformations, temperatureExterieure) == offsetMot(0x79E0, 0x79FB), "Extérieure attendue en 0x79FB");
+
+// Réponse 0x7A18 (0x7AE0 pour une chaudière 0x84) / 0x001C : consommations en kWh
+struct SchemaConsommation {
+    static constexpr uint16_t adresse = 0x7A18;
+    static constexpr uint16_t taille = 0x001C;
+
+    RadioTrameHeader header;
+    uint8_t longueurDonnees;
+    byte i1[18];
+    fword consommationECS;
+    fword consommationChauffage;
+    byte i2[34];
+};
+static_assert(offsetof(SchemaConsommation, consommationECS) == offsetMot(0x7A18, 0x7A21), "Consommation ECS attendue en 0x7A21");
+
+// Réponse 0xA02B / 0x0003 : date courante de la chaudière
+struct SchemaDate {
+    static constexpr uint16_t adresse = 0xA02B;
+    static constexpr uint16_t taille = 0x0003;
+
+    RadioTrameHeader header;
+    uint8_t longueurDonnees;
+    byte date[6];               // format reçu "YY MM DD hh mm ss"
+};
+
+// Réponse 0x9C54 / 0x0004 : date renvoyée à la sonde extérieure
+struct SchemaSonde {
+    static constexpr uint16_t adresse = 0x9C54;
+    static constexpr uint16_t taille = 0x0004;
+
+    RadioTrameHeader header;
+    uint8_t longueur;
+    byte date[6];
+    uint8_t i1;
+    uint8_t jour;
+};
+
+// Réponse 0xA0FC / 0x0001 : mode ECS
+struct SchemaModeECS {
+    static constexpr uint16_t adresse = 0xA0FC;
+    static constexpr uint16_t taille = 0x0001;
+
+    RadioTrameHeader header;
+    uint8_t longueurDonnees;
+    byte i1;
+    byte modeECS;               // Bit 0x80 positionné par la chaudière
+};
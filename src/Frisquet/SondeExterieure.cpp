@@ -1,5 +1,6 @@
 #include "SondeExterieure.h"
 #include <math.h>
+#include "Schemas.h"
 
 void SondeExterieure::loadConfig() {
     bool checkMigration = false;
@@ -37,53 +38,41 @@ float SondeExterieure::getTemperatureExterieure() {
     return _temperatureExterieure;
 }
 
-bool SondeExterieure::envoyerTemperatureExterieure() {
+bool SondeExterieure::envoyerTemperatureExterieure(std::function<void(bool)> callback) {
     if(! estAssocie() || isnan(_temperatureExterieure)) {
         return false;
     }
 
-    struct {
-        FrisquetRadio::RadioTrameHeader header;
-        uint8_t longueur;
-        byte date[6] = {0};
-        uint8_t i1;
-        uint8_t jour;
-    } donnees;
+    uint32_t id = this->radio().submitInit(
+        this->getId(), 
+        ID_CHAUDIERE, 
+        this->getIdAssociation(),
+        this->incrementIdMessage(),
+        0x01, 
+        SchemaSonde::adresse,
+        SchemaSonde::taille,
+        0xa029,
+        0x0001,
+        temperature16(_temperatureExterieure).bytes,
+        sizeof(temperature16),
+        [this, callback](int16_t err, const byte* reponse, size_t length) {
+            const SchemaSonde* donnees = vueTrame<SchemaSonde>(reponse, length);
+            if(err != RADIOLIB_ERR_NONE || !donnees) {
+                if(callback) {
+                    callback(false);
+                }
+                return;
+            }
 
-    size_t length;
-    int16_t err;
-    
-    uint8_t retry = 0;
-    do {
-        length = sizeof(donnees);
-        err = this->radio().sendInit(
-            this->getId(), 
-            ID_CHAUDIERE, 
-            this->getIdAssociation(),
-            this->incrementIdMessage(),
-            0x01, 
-            0x9c54,
-            0x0004,
-            0xa029,
-            0x0001,
-            temperature16(_temperatureExterieure).bytes,
-            sizeof(temperature16),
-            (byte*)&donnees,
-            length
-        );
-
-        if(err != RADIOLIB_ERR_NONE || length < sizeof(donnees)) {
-            delay(100);
-            continue;
-        }
+            setDate(Date(donnees->date));
 
-        Date date = Date(donnees.date);
-        setDate(date);
-        
-        return true;
-    } while(retry++ < 1);
+            if(callback) {
+                callback(true);
+            }
+        }
+    );
 
-    return false;
+    return id != 0;
 }
 
 
@@ -130,7 +119,7 @@ void SondeExterieure::loop() {
    uint32_t now = millis();
 
     if(estAssocie()) {
-        if (now - _lastEnvoiTemperatureExterieure >= 600000 || _lastEnvoiTemperatureExterieure == 0) { // 10 minutes
+        if (relevePret(_lastEnvoiTemperatureExterieure, 600000) || _lastEnvoiTemperatureExterieure == 0) { // 10 minutes
             info("[SONDE EXTERIEURE] Envoi de la température extérieure.");
             // Récupération de la température si DS18B20 activé.
             if(_ds18b20 != nullptr && _ds18b20->isReady()) {
@@ -142,12 +131,17 @@ void SondeExterieure::loop() {
             }
             
             if(!isnan(getTemperatureExterieure())) {
-                if(envoyerTemperatureExterieure()) {
-                    publishMqtt();
-                    _lastEnvoiTemperatureExterieure = now;
-                } else {
-                    error("[SONDE EXTERIEURE] Echec de l'envoi de la température extérieure.");
-                    _lastEnvoiTemperatureExterieure = now <= 60000 ? 1 : now - 60000;; // Essai dans 1 minute
+                _lastEnvoiTemperatureExterieure = now;
+                bool soumis = envoyerTemperatureExterieure([this, now](bool ok) {
+                    if(ok) {
+                        publishMqtt();
+                    } else {
+                        error("[SONDE EXTERIEURE] Echec de l'envoi de la température extérieure.");
+                        _lastEnvoiTemperatureExterieure = now <= 60000 ? 1 : now - 60000; // Essai dans 1 minute
+                    }
+                });
+                if(!soumis) {
+                    _lastEnvoiTemperatureExterieure = now <= 60000 ? 1 : now - 60000;
                 }
             } else {
                 warning("[SONDE EXTERIEURE] Aucune température disponible.");
@@ -12,7 +12,7 @@ class SondeExterieure : public FrisquetDevice {
         void loadConfig();
         void saveConfig();
 
-        bool envoyerTemperatureExterieure();
+        bool envoyerTemperatureExterieure(std::function<void(bool)> callback = nullptr);
 
         float getTemperatureExterieure();
         void setTemperatureExterieure(float temperature);
@@ -0,0 +1,105 @@
+#include "TrafficLearner.h"
+
+TrafficLearner::Appareil* TrafficLearner::trouver(uint8_t id, uint8_t idDestinataire, uint8_t type, uint32_t now) {
+    Appareil* libre = nullptr;
+    Appareil* plusAncien = &_appareils[0];
+    for(Appareil& appareil : _appareils) {
+        if(appareil.actif && appareil.id == id && appareil.idDestinataire == idDestinataire && appareil.type == type) {
+            return &appareil;
+        }
+        if(!appareil.actif && !libre) {
+            libre = &appareil;
+        }
+        if(now - appareil.derniereEmission > now - plusAncien->derniereEmission) {
+            plusAncien = &appareil;
+        }
+    }
+
+    Appareil* appareil = libre ? libre : plusAncien;
+    *appareil = Appareil();
+    appareil->id = id;
+    appareil->idDestinataire = idDestinataire;
+    appareil->type = type;
+    return appareil;
+}
+
+void TrafficLearner::observer(uint8_t idExpediteur, uint8_t idDestinataire, uint8_t type, uint32_t now) {
+    Appareil* appareil = trouver(idExpediteur, idDestinataire, type, now);
+    if(!appareil->actif) {
+        appareil->actif = true;
+        appareil->derniereEmission = now;
+        return;
+    }
+
+    uint32_t intervalle = now - appareil->derniereEmission;
+    if(intervalle < kPeriodeMinMs) {
+        return;
+    }
+    appareil->derniereEmission = now;
+
+    if(appareil->periodeMs == 0) {
+        appareil->periodeMs = intervalle;
+        return;
+    }
+
+    // Trames manquées : l'intervalle est un multiple de la période
+    uint32_t multiple = (intervalle + appareil->periodeMs / 2) / appareil->periodeMs;
+    if(multiple >= 1) {
+        uint32_t echantillon = intervalle / multiple;
+        uint32_t ecart = echantillon > appareil->periodeMs ? echantillon - appareil->periodeMs : appareil->periodeMs - echantillon;
+        if(ecart <= appareil->periodeMs / 5) {
+            appareil->periodeMs = (appareil->periodeMs * 3 + echantillon) / 4;
+            if(appareil->confiance < 255) {
+                ++appareil->confiance;
+            }
+            return;
+        }
+    }
+
+    // Rythme différent : nouvel apprentissage
+    appareil->periodeMs = intervalle;
+    appareil->confiance = 0;
+}
+
+uint32_t TrafficLearner::prochaineEmission(uint32_t now) const {
+    uint32_t prochaine = UINT32_MAX;
+    for(const Appareil& appareil : _appareils) {
+        if(!appareil.actif || appareil.confiance < kConfianceMin || appareil.periodeMs == 0) {
+            continue;
+        }
+        uint32_t ecoule = now - appareil.derniereEmission;
+        if(ecoule > appareil.periodeMs * 4) { // Appareil silencieux depuis longtemps : prévision caduque
+            continue;
+        }
+        uint32_t delai = appareil.periodeMs - ecoule % appareil.periodeMs;
+        if(delai < prochaine) {
+            prochaine = delai;
+        }
+    }
+    return prochaine;
+}
+
+bool TrafficLearner::estCalme(uint32_t now, uint32_t margeMs) const {
+    for(const Appareil& appareil : _appareils) {
+        if(!appareil.actif || appareil.confiance < kConfianceMin || appareil.periodeMs == 0) {
+            continue;
+        }
+        uint32_t ecoule = now - appareil.derniereEmission;
+        if(ecoule > appareil.periodeMs * 4) {
+            continue;
+        }
+        uint32_t phase = ecoule % appareil.periodeMs;
+        if(phase < margeMs || appareil.periodeMs - phase < margeMs) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TrafficLearner::relevePret(uint32_t derniere, uint32_t periodeMs, uint32_t now) const {
+    uint32_t ecoule = now - derniere;
+    if(ecoule < periodeMs) {
+        return false;
+    }
+    return ecoule >= periodeMs + kReportMaxMs || estCalme(now);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <heltec.h>
+
+// Observation passive du trafic : période et phase d'émission de chaque échange
+// (expéditeur, destinataire, type de message), apprises à partir des trames reçues.
+// La chaudière s'adresse à plusieurs appareils à des rythmes différents : chaque
+// échange a sa propre cadence. Les relevés périodiques sont placés hors des
+// émissions prévues.
+class TrafficLearner {
+    public:
+        static constexpr size_t kMaxAppareils = 24;         // Échanges suivis
+        static constexpr uint32_t kPeriodeMinMs = 2000;     // En deçà : répétition ou échange en cours
+        static constexpr uint8_t kConfianceMin = 3;         // Intervalles cohérents avant toute prévision
+        static constexpr uint32_t kMargeMs = 2000;          // Écart minimal avec une émission prévue
+        static constexpr uint32_t kReportMaxMs = 30000;     // Report maximal d'un relevé à échéance
+
+        struct Appareil {
+            uint8_t id = 0;             // Expéditeur
+            uint8_t idDestinataire = 0;
+            uint8_t type = 0;
+            bool actif = false;
+            uint32_t derniereEmission = 0;
+            uint32_t periodeMs = 0;
+            uint8_t confiance = 0;
+        };
+
+        // Trame initiale (hors accusé) reçue à l'instant now (millis() de l'interruption de réception)
+        void observer(uint8_t idExpediteur, uint8_t idDestinataire, uint8_t type, uint32_t now);
+
+        // true si aucun appareil n'est attendu à moins de margeMs de now
+        bool estCalme(uint32_t now, uint32_t margeMs = kMargeMs) const;
+
+        // Relevé périodique dû : échéance (derniere + periodeMs) passée et créneau calme,
+        // ou échéance dépassée de kReportMaxMs
+        bool relevePret(uint32_t derniere, uint32_t periodeMs, uint32_t now) const;
+
+        // Délai avant la prochaine émission prévue d'un appareil, UINT32_MAX si aucune
+        uint32_t prochaineEmission(uint32_t now) const;
+
+        const Appareil* appareils() const { return _appareils; }
+
+    private:
+        Appareil* trouver(uint8_t id, uint8_t idDestinataire, uint8_t type, uint32_t now);
+
+        Appareil _appareils[kMaxAppareils];
+};
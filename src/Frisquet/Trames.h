@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Format des trames radio Frisquet, sans dépendance Arduino :
+// partagé par le firmware (FrisquetRadio) et les outils hôte (Sim/).
+
+#define ID_CHAUDIERE 0x80
+#define ID_ZONE_1 0x08
+#define ID_ZONE_2 0x09
+#define ID_ZONE_3 0x0A
+#define ID_SONDE_EXTERIEURE 0x20
+#define ID_CONNECT 0x7E
+
+// Mot de 16 bits tel que transmis (poids fort en premier)
+struct fword {
+    fword() {}
+    fword(uint8_t b1, uint8_t b2) {
+        bytes[0] = b1;
+        bytes[1] = b2;
+    }
+    fword(uint8_t bytes[]) {
+        memcpy(this->bytes, bytes, 2);
+    }
+    fword(uint16_t intValue) {
+        this->bytes[0] = (intValue >> 8) & 0xFF;
+        this->bytes[1] = intValue & 0xFF;
+    }
+
+    uint16_t toUInt16() const {
+        uint16_t intValue = bytes[0] << 8 | bytes[1];
+        return intValue;
+    }
+
+    uint16_t toInt16() const {
+        int16_t intValue = bytes[0] << 8 | bytes[1];
+        return intValue;
+    }
+
+    uint8_t bytes[2] = {0};
+};
+
+struct RadioMessageType {
+    enum Type : uint8_t {
+        READ = 0x03,
+        INIT = 0x17,
+        ASSOCIATION = 0x41,
+        REFUS = 0x83            // Adresse mémoire refusée par la chaudière
+    };
+};
+
+struct RadioTrameHeader {
+    uint8_t idDestinataire = 0x00;
+    uint8_t idExpediteur = 0x00;
+    uint8_t idAssociation = 0x00;
+    uint8_t idMessage = 0x00;
+    uint8_t idReception = 0x01; //0x01 => Si message direct, sinon id destinataire finale (exemple envoi au satellite Z1 via chaudière) + 0x80 si accusé réception
+    uint8_t type = 0x00;
+
+    void answer(RadioTrameHeader& radioTrameHeader) {
+        radioTrameHeader.idExpediteur = idDestinataire;
+        radioTrameHeader.idDestinataire = idExpediteur;
+        radioTrameHeader.idAssociation = idAssociation;
+        radioTrameHeader.idMessage = idMessage;
+        radioTrameHeader.idReception = idReception | 0x80;
+        radioTrameHeader.type = type;
+    }
+
+    bool isAck() {
+        return idReception >= 0x80;
+    }
+};
+
+struct RadioTrameAsk {
+    fword adresseMemoire;
+    fword tailleMemoire;
+};
+
+struct RadioTrameInit {
+    fword adresseMemoireLecture;
+    fword tailleMemoireLecture;
+    fword adresseMemoireEcriture;
+    fword tailleMemoireEcriture;
+    uint8_t longueurDonneesEcriture;
+};
@@ -1,32 +1,6 @@
 #pragma once
 #include <heltec.h>
-
-struct fword {
-    fword() {}
-    fword(byte b1, byte b2) {
-        bytes[0] = b1;
-        bytes[1] = b2;
-    }
-    fword(byte bytes[]) {
-        memcpy(this->bytes, bytes, 2);
-    }
-    fword(uint16_t intValue) {
-        this->bytes[0] = (intValue >> 8) & 0xFF;
-        this->bytes[1] = intValue & 0xFF;
-    }
-
-    uint16_t toUInt16() const {
-        uint16_t intValue = bytes[0] << 8 | bytes[1];
-        return intValue;
-    }
-
-    uint16_t toInt16() const {
-        int16_t intValue = bytes[0] << 8 | bytes[1];
-        return intValue;
-    }
-
-    byte bytes[2] = {0};
-};
+#include "Trames.h"
 
 struct temperature8 {
     uint8_t value = 0;
@@ -219,7 +193,7 @@ struct Date {
     uint8_t seconde = 0;
 
     Date() {}
-    Date(byte donnees[6]) {
+    Date(const byte donnees[6]) {
         annee = ((donnees[0] >> 4) * 10) + (donnees[0] & 0x0F);
         mois = ((donnees[1] >> 4) * 10) + (donnees[1] & 0x0F);
         jour = ((donnees[2] >> 4) * 10) + (donnees[2] & 0x0F);
@@ -11,6 +11,8 @@ void FrisquetManager::begin()
 {
     // Init radio
     _radio.init();
+    _radio.calibration().appliquer(_cfg.radioOffsetKHz(), _cfg.radioRxBandwidthKHz());
+    _radio.accuses().setDelaiMaxMs(_cfg.ackDeadlineMs());
     _radio.setNetworkID(_cfg.getNetworkID());
 
     initMqtt();
@@ -75,20 +77,254 @@ void FrisquetManager::begin()
 
     _mqtt.publishAvailability(*_mqtt.getDevice("heltecFrisquet"), true);
 
-    _radio.onReceive([]()
-                     {
-    if(!FrisquetRadio::interruptReceive) {
-        FrisquetRadio::receivedFlag = true;
-    } });
-    _radio.startReceive();
+    initRoutes();
+    _radio.beginReceive();
+}
+
+bool FrisquetManager::startTask()
+{
+    if (_task != nullptr) {
+        return true;
+    }
+    if (!_commands.begin() || !_results.begin()) {
+        error("[RADIO] Impossible de créer la file de commandes.");
+        return false;
+    }
+    if (xTaskCreatePinnedToCore(FrisquetManager::taskMain, "frisquet", kTaskStackSize, this, kTaskPriority, &_task, kTaskCore) != pdPASS) {
+        _task = nullptr;
+        error("[RADIO] Impossible de démarrer la tâche radio.");
+        return false;
+    }
+    FrisquetRadio::rxTask = _task;
+    info("[RADIO] Tâche radio démarrée sur le cœur %d.", kTaskCore);
+    return true;
+}
+
+void FrisquetManager::taskMain(void* param)
+{
+    FrisquetManager* manager = static_cast<FrisquetManager*>(param);
+    for (;;) {
+        // Réveil par l'interruption DIO, une commande, ou à défaut périodiquement
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kTaskIdleMs));
+        manager->loop();
+    }
+}
+
+int16_t FrisquetManager::demander(Command& command, uint32_t attenteMs, Result* result)
+{
+    if (_task == nullptr) {
+        return kErrTacheIndisponible;
+    }
+
+    command.id = ++_commandId;
+    if (!_commands.send(command, pdMS_TO_TICKS(kAttenteFileMs))) {
+        error("[RADIO] Tâche radio occupée, commande refusée.");
+        return kErrTacheIndisponible;
+    }
+    xTaskNotifyGive(_task);
+
+    // Résultats d'une commande abandonnée après expiration de son délai : ignorés
+    uint32_t debut = millis();
+    Result recu;
+    for (;;) {
+        uint32_t ecoule = millis() - debut;
+        if (ecoule >= attenteMs || !_results.receive(recu, pdMS_TO_TICKS(attenteMs - ecoule))) {
+            error("[RADIO] Commande sans résultat après %d ms.", attenteMs);
+            return kErrDelaiDepasse;
+        }
+        if (recu.id == command.id) {
+            break;
+        }
+    }
+    if (result != nullptr) {
+        *result = recu;
+    }
+    return recu.err;
+}
+
+int16_t FrisquetManager::demanderLectureMemoire(uint8_t idExpediteur, uint8_t idAssociation, uint8_t idMessage, uint16_t adresse,
+                                                uint16_t taille, uint8_t retry, byte* reponse, size_t& length)
+{
+    Command command;
+    command.type = Command::LECTURE_MEMOIRE;
+    command.lecture.idExpediteur = idExpediteur;
+    command.lecture.idAssociation = idAssociation;
+    command.lecture.idMessage = idMessage;
+    command.lecture.retry = retry;
+    command.lecture.adresse = adresse;
+    command.lecture.taille = taille;
+
+    Result result;
+    int16_t err = demander(command, kAttenteLectureMs, &result);
+    if (err != RADIOLIB_ERR_NONE) {
+        return err;
+    }
+    length = result.length < length ? result.length : length;
+    memcpy(reponse, result.donnees, length);
+    return RADIOLIB_ERR_NONE;
+}
+
+int16_t FrisquetManager::demanderEmission(const byte* payload, size_t length)
+{
+    if (length > kTrameMax) {
+        return RADIOLIB_ERR_PACKET_TOO_LONG;
+    }
+    Command command;
+    command.type = Command::EMISSION;
+    command.emission.length = length;
+    memcpy(command.emission.payload, payload, length);
+    return demander(command, kAttenteCommandeMs);
+}
+
+int16_t FrisquetManager::demanderAssociation(APPAREIL appareil)
+{
+    Command command;
+    command.type = Command::ASSOCIATION;
+    command.appareil = appareil;
+    return demander(command, kAttenteAssociationMs);
+}
+
+int16_t FrisquetManager::demanderRecuperationNetworkID()
+{
+    Command command;
+    command.type = Command::RECUPERATION_NETWORKID;
+    return demander(command, kAttenteAssociationMs);
+}
+
+int16_t FrisquetManager::demanderCalibration(uint32_t palierMs)
+{
+    Command command;
+    command.type = Command::CALIBRATION;
+    command.palierMs = palierMs;
+    return demander(command, kAttenteCommandeMs);
+}
+
+int16_t FrisquetManager::demanderAnnulationCalibration()
+{
+    Command command;
+    command.type = Command::ANNULATION_CALIBRATION;
+    return demander(command, kAttenteCommandeMs);
+}
+
+void FrisquetManager::repondre(uint32_t id, int16_t err, const byte* donnees, size_t length)
+{
+    Result result;
+    result.id = id;
+    result.err = err;
+    result.length = length < sizeof(result.donnees) ? length : sizeof(result.donnees);
+    if (result.length > 0) {
+        memcpy(result.donnees, donnees, result.length);
+    }
+    _results.send(result);   // Appelant parti (délai dépassé) et file pleine : résultat perdu
+}
+
+template <typename T>
+bool FrisquetManager::associer(T& appareil)
+{
+    NetworkID networkId;
+    uint8_t idAssociation;
+    if (!appareil.associer(networkId, idAssociation)) {
+        return false;
+    }
+    appareil.setIdAssociation(idAssociation);
+    _radio.setNetworkID(networkId);
+    _cfg.setNetworkID(networkId);
+    _cfg.save();
+    appareil.saveConfig();
+    return true;
+}
+
+void FrisquetManager::executer(const Command& command)
+{
+    bool ok = false;
+    switch (command.type) {
+        case Command::LECTURE_MEMOIRE: {
+            // Réponse transmise depuis le rappel : la tâche radio continue de servir la file RX
+            uint32_t id = command.id;
+            uint32_t transaction = _radio.submitAsk(
+                command.lecture.idExpediteur,
+                ID_CHAUDIERE,
+                command.lecture.idAssociation,
+                command.lecture.idMessage,
+                0x01,
+                command.lecture.adresse,
+                command.lecture.taille,
+                [this, id](int16_t err, const byte* donnees, size_t length) {
+                    repondre(id, err, donnees, err == RADIOLIB_ERR_NONE ? length : 0);
+                },
+                command.lecture.retry,
+                DutyCycle::PRIORITE::DEBUG);
+            if (transaction == 0) {
+                repondre(command.id, kErrTacheIndisponible);
+            }
+            return;
+        }
+        case Command::EMISSION: {
+            byte payload[kTrameMax];
+            memcpy(payload, command.emission.payload, command.emission.length);
+            repondre(command.id, _radio.transmitFrame(payload, command.emission.length, DutyCycle::PRIORITE::DEBUG));
+            return;
+        }
+        case Command::ASSOCIATION:
+            switch (command.appareil) {
+                case APPAREIL::CONNECT:          ok = associer(_connect); break;
+                case APPAREIL::SONDE_EXTERIEURE: ok = associer(_sondeExterieure); break;
+                case APPAREIL::SATELLITE_Z1:     ok = associer(_satelliteZ1); break;
+                case APPAREIL::SATELLITE_Z2:     ok = associer(_satelliteZ2); break;
+                case APPAREIL::SATELLITE_Z3:     ok = associer(_satelliteZ3); break;
+            }
+            break;
+        case Command::RECUPERATION_NETWORKID:
+            ok = recupererNetworkID();
+            break;
+        case Command::CALIBRATION:
+            ok = calibrerRadio(command.palierMs);
+            break;
+        case Command::ANNULATION_CALIBRATION:
+            _radio.calibration().annuler();
+            ok = true;
+            break;
+    }
+    repondre(command.id, ok ? RADIOLIB_ERR_NONE : RADIOLIB_ERR_UNKNOWN);
+}
+
+void FrisquetManager::processCommands()
+{
+    Command command;
+    while (_commands.receive(command)) {
+        executer(command);
+    }
+
+    // Commandes Home Assistant reçues par la tâche MQTT
+    _mqtt.processCommands();
 }
 
 void FrisquetManager::loop()
 {
     uint32_t now = millis();
 
-    if (FrisquetRadio::receivedFlag) { // Réception données radio
-        onRadioReceive();
+    processCommands();
+
+    // Réception données radio : vidage de la file RX alimentée par l'interruption
+    _radio.pollReceive();
+    RadioFrame frame;
+    while (_radio.rxQueue().pop(frame)) {
+        onRadioReceive(frame);
+        _radio.pollReceive();
+    }
+    _radio.setHorodatageReception(0);
+
+    // Émissions, relances et rappels des transactions en cours
+    _radio.transactions().loop();
+    _radio.interceptions().loop();
+    _radio.calibration().loop();
+
+    // Travaux différés du chemin de réception, la radio étant revenue en réception
+    _radio.travaux().vider();
+
+    if (now - _lastDiagnostics >= kDiagnosticsMs) {
+        _lastDiagnostics = now;
+        publierDiagnostics();
     }
 
     if (_cfg.useConnect()) {
@@ -108,6 +344,9 @@ void FrisquetManager::loop()
     if (_cfg.useSatelliteZ3()) {
         _satelliteZ3.loop();
     }
+
+    // Lectures mémoire déclarées par les appareils, fusionnées en un minimum de transactions
+    _radio.lectures().loop();
 }
 
 void FrisquetManager::initDS18B20()
@@ -147,66 +386,202 @@ void FrisquetManager::initMqtt()
     _device.baseTopic = _cfg.getMQTTOptions().baseTopic;
     _device.swVersion = "2.0.0";
     _mqtt.registerDevice(_device);
+
+    // Diagnostic : liaison avec la chaudière, détail par appareil en attributs
+    _mqttDiagnostics.rssiChaudiere.id = "rssiChaudiere";
+    _mqttDiagnostics.rssiChaudiere.name = "RSSI chaudière";
+    _mqttDiagnostics.rssiChaudiere.component = "sensor";
+    _mqttDiagnostics.rssiChaudiere.stateTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "rssiChaudiere"}), 0, true);
+    _mqttDiagnostics.rssiChaudiere.set("device_class", "signal_strength");
+    _mqttDiagnostics.rssiChaudiere.set("state_class", "measurement");
+    _mqttDiagnostics.rssiChaudiere.set("unit_of_measurement", "dBm");
+    _mqttDiagnostics.rssiChaudiere.set("entity_category", "diagnostic");
+    _mqtt.registerEntity(_device, _mqttDiagnostics.rssiChaudiere, true);
+
+    _mqttDiagnostics.succesChaudiere.id = "succesRadioChaudiere";
+    _mqttDiagnostics.succesChaudiere.name = "Succès échanges chaudière";
+    _mqttDiagnostics.succesChaudiere.component = "sensor";
+    _mqttDiagnostics.succesChaudiere.stateTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "succesChaudiere"}), 0, true);
+    _mqttDiagnostics.succesChaudiere.attributesTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "liens"}), 0, true);
+    _mqttDiagnostics.succesChaudiere.set("state_class", "measurement");
+    _mqttDiagnostics.succesChaudiere.set("unit_of_measurement", "%");
+    _mqttDiagnostics.succesChaudiere.set("icon", "mdi:access-point-check");
+    _mqttDiagnostics.succesChaudiere.set("entity_category", "diagnostic");
+    _mqtt.registerEntity(_device, _mqttDiagnostics.succesChaudiere, true);
+
+    _mqttDiagnostics.latenceChaudiere.id = "latenceRadioChaudiere";
+    _mqttDiagnostics.latenceChaudiere.name = "Aller-retour chaudière";
+    _mqttDiagnostics.latenceChaudiere.component = "sensor";
+    _mqttDiagnostics.latenceChaudiere.stateTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "latenceChaudiere"}), 0, true);
+    _mqttDiagnostics.latenceChaudiere.set("device_class", "duration");
+    _mqttDiagnostics.latenceChaudiere.set("state_class", "measurement");
+    _mqttDiagnostics.latenceChaudiere.set("unit_of_measurement", "ms");
+    _mqttDiagnostics.latenceChaudiere.set("entity_category", "diagnostic");
+    _mqtt.registerEntity(_device, _mqttDiagnostics.latenceChaudiere, true);
+
+    // Diagnostic : délai de réponse des appareils émulés
+    _mqttDiagnostics.delaiAccuse.id = "delaiAccuse";
+    _mqttDiagnostics.delaiAccuse.name = "Délai accusé";
+    _mqttDiagnostics.delaiAccuse.component = "sensor";
+    _mqttDiagnostics.delaiAccuse.stateTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "delaiAccuse"}), 0, true);
+    _mqttDiagnostics.delaiAccuse.set("device_class", "duration");
+    _mqttDiagnostics.delaiAccuse.set("state_class", "measurement");
+    _mqttDiagnostics.delaiAccuse.set("unit_of_measurement", "ms");
+    _mqttDiagnostics.delaiAccuse.set("entity_category", "diagnostic");
+    _mqtt.registerEntity(_device, _mqttDiagnostics.delaiAccuse, true);
+
+    _mqttDiagnostics.depassementsAccuse.id = "depassementsAccuse";
+    _mqttDiagnostics.depassementsAccuse.name = "Accusés hors délai";
+    _mqttDiagnostics.depassementsAccuse.component = "sensor";
+    _mqttDiagnostics.depassementsAccuse.stateTopic = MqttTopic(MqttManager::compose({_device.baseTopic, "radio", "depassementsAccuse"}), 0, true);
+    _mqttDiagnostics.depassementsAccuse.set("state_class", "total_increasing");
+    _mqttDiagnostics.depassementsAccuse.set("icon", "mdi:timer-alert-outline");
+    _mqttDiagnostics.depassementsAccuse.set("entity_category", "diagnostic");
+    _mqtt.registerEntity(_device, _mqttDiagnostics.depassementsAccuse, true);
 }
 
-void FrisquetManager::onRadioReceive()
+void FrisquetManager::publierDiagnostics()
 {
-    //FrisquetRadio::interruptReceive = true;
-    FrisquetRadio::receivedFlag = false;
+    const LinkStats::Pair* chaudiere = _radio.liens().pair(ID_CHAUDIERE);
+    if (chaudiere) {
+        if (!isnan(chaudiere->rssi)) {
+            _mqtt.publishState(_mqttDiagnostics.rssiChaudiere, chaudiere->rssi, 0);
+        }
+        if (chaudiere->transactions() > 0) {
+            _mqtt.publishState(_mqttDiagnostics.succesChaudiere, chaudiere->tauxSucces(), 1);
+        }
+        if (chaudiere->succes > 0) {
+            _mqtt.publishState(_mqttDiagnostics.latenceChaudiere, chaudiere->latenceUs / 1000.0f, 0);
+        }
+    }
 
-    byte buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
-    size_t length = 0;
-    int16_t err = _radio.readData(buff, 0);
+    AckTurnaround& accuses = _radio.accuses();
+    if (accuses.dernierUs() > 0) {
+        _mqtt.publishState(_mqttDiagnostics.delaiAccuse, accuses.dernierUs() / 1000.0f, 0);
+    }
+    _mqtt.publishState(_mqttDiagnostics.depassementsAccuse, String(accuses.depassements()));
+
+    JsonDocument doc;
+    for (size_t i = 0; i < LinkStats::kMaxPairs; i++) {
+        const LinkStats::Pair& pair = _radio.liens().pairs()[i];
+        if (!pair.actif) {
+            continue;
+        }
+        char id[8];
+        snprintf(id, sizeof(id), "0x%02X", pair.id);
+        JsonVariant lien = doc[id];
+        lien["trames"] = pair.trames;
+        if (!isnan(pair.rssi)) {
+            lien["rssi"] = roundf(pair.rssi);
+            lien["rssiMin"] = pair.rssiMin;
+            lien["rssiMax"] = pair.rssiMax;
+        }
+        lien["succes"] = pair.succes;
+        lien["expirations"] = pair.expirations;
+        lien["refus"] = pair.refus;
+        lien["latenceMs"] = pair.latenceUs / 1000;
+    }
+    _mqtt.publishJson(_mqttDiagnostics.succesChaudiere.attributesTopic, doc);
+}
 
-    if (err != RADIOLIB_ERR_NONE)
+void FrisquetManager::onRadioReceive(RadioFrame& frame)
+{
+    // Chemin rapide : seul le travail protocolaire est fait ici, le reste passe par _radio.travaux()
+    byte* buff = frame.data;
+    size_t length = frame.length;
+    RadioFrameLog& trames = _radio.trames();
+
+    if (length < sizeof(FrisquetRadio::RadioTrameHeader))
     {
-        FrisquetRadio::interruptReceive = false;
+        trames.qualifier(frame.journal, RadioFrameLog::IGNOREE);
         return;
     }
 
-    length = _radio.getPacketLength();
-    _radio.startReceive();
+    // Référence des délais de réponse : accusé émis ou renvoyé, réponse interceptée
+    _radio.setHorodatageReception(frame.timestamp);
 
-    info("[RADIO] Réception données radio : %d bytes", length);
+    // Réponse de la chaudière attendue par un appareil à l'écoute
+    if (_radio.interceptions().onFrame(frame)) {
+        trames.qualifier(frame.journal, RadioFrameLog::INTERCEPTEE);
+        return;
+    }
 
-    logRadio(true, buff, length);
+    const FrisquetRadio::RadioTrameHeader* header = (const FrisquetRadio::RadioTrameHeader*)buff;
+    if (header->idReception < 0x80) {
+        // Instant de l'interruption de réception, ramené sur millis() : indépendant de l'attente en file
+        uint32_t reception = millis() - (micros() - frame.timestamp) / 1000;
+        _radio.trafic().observer(header->idExpediteur, header->idDestinataire, header->type, reception);
+    }
 
-    if (length < sizeof(FrisquetRadio::RadioTrameHeader))
-    {
-        FrisquetRadio::interruptReceive = false;
+    // Répétition d'une trame déjà traitée : ni décodage ni publication
+    if (_radio.filtrerDoublon(buff, length)) {
+        trames.qualifier(frame.journal, RadioFrameLog::DOUBLON);
+        _radio.travaux().differer([length]() {
+            debug("[RADIO] Répétition ignorée : %d bytes.", length);
+        });
         return;
     }
 
-    FrisquetRadio::RadioTrameHeader *header = (FrisquetRadio::RadioTrameHeader *)buff;
-    if (_cfg.useConnect() &&
-        (header->idDestinataire == _connect.getId() ||
-         (_cfg.useConnectPassive() && header->idExpediteur == _connect.getId() && header->idDestinataire == ID_CHAUDIERE))) {
-        info("[RADIO] Traitement données Connect");
-        _connect.onReceive(buff, length);
-    } else if (header->idDestinataire == _satelliteZ1.getId() && _cfg.useSatelliteZ1() && _cfg.useSatelliteVirtualZ1()) {
-        info("[RADIO] Traitement données Satellite Z1");
-        _satelliteZ1.onReceive(buff, length);
-    } else if (header->idDestinataire == _satelliteZ2.getId() && _cfg.useSatelliteZ2() && _cfg.useSatelliteVirtualZ2()) {
-        info("[RADIO] Traitement données Satellite Z2");
-        _satelliteZ2.onReceive(buff, length);
-    } else if (header->idDestinataire == _satelliteZ3.getId() && _cfg.useSatelliteZ3() && _cfg.useSatelliteVirtualZ3()) {
-        info("[RADIO] Traitement données Satellite Z2");
-        _satelliteZ3.onReceive(buff, length);
-    } else if (header->idExpediteur == _satelliteZ1.getId() && _cfg.useSatelliteZ1() && !_cfg.useSatelliteVirtualZ1()) {
-        info("[RADIO] Traitement données envoi Satellite Z1");
-        _satelliteZ1.onReceive(buff, length);
-    } else if (header->idExpediteur == _satelliteZ2.getId() && _cfg.useSatelliteZ2() && !_cfg.useSatelliteVirtualZ2()) {
-        info("[RADIO] Traitement données envoi Satellite Z2");
-        _satelliteZ2.onReceive(buff, length);
-    } else if (header->idExpediteur == _satelliteZ3.getId() && _cfg.useSatelliteZ3() && !_cfg.useSatelliteVirtualZ3()) {
-        info("[RADIO] Traitement données envoi Satellite Z3");
-        _satelliteZ3.onReceive(buff, length);
-    }
-
-    FrisquetRadio::interruptReceive = false;
+    const FrisquetRouter::Route* route = _routeur.trouver(*header);
+    trames.qualifier(frame.journal, route ? RadioFrameLog::ROUTEE : RadioFrameLog::IGNOREE);
+    float rssi = frame.rssi;
+    _radio.travaux().differer([length, rssi, route]() {
+        info("[RADIO] Réception données radio : %d bytes (RSSI %.0f dBm)", length, rssi);
+        if (route) {
+            info("[RADIO] Traitement données %s", route->nom);
+        }
+    });
+
+    _routeur.router(buff, length);
+}
+
+void FrisquetManager::initRoutes()
+{
+    // Construite une fois : la configuration n'évolue qu'après un redémarrage
+    _routeur.vider();
+
+    if (_cfg.useConnect()) {
+        _routeur.ajouter("Connect", _connect, _connect.getId(), FrisquetRouter::kTous);
+        if (_cfg.useConnectPassive()) {
+            _routeur.ajouter("Connect (écoute)", _connect, ID_CHAUDIERE, _connect.getId());
+        }
+    }
+
+    struct {
+        Satellite& satellite;
+        bool actif;
+        bool virtuel;
+        const char* nomVirtuel;
+        const char* nomPhysique;
+    } satellites[] = {
+        { _satelliteZ1, _cfg.useSatelliteZ1(), _cfg.useSatelliteVirtualZ1(), "Satellite Z1", "envoi Satellite Z1" },
+        { _satelliteZ2, _cfg.useSatelliteZ2(), _cfg.useSatelliteVirtualZ2(), "Satellite Z2", "envoi Satellite Z2" },
+        { _satelliteZ3, _cfg.useSatelliteZ3(), _cfg.useSatelliteVirtualZ3(), "Satellite Z3", "envoi Satellite Z3" },
+    };
+
+    for (auto& s : satellites) {
+        if (!s.actif) {
+            continue;
+        }
+        if (s.virtuel) {
+            _routeur.ajouter(s.nomVirtuel, s.satellite, s.satellite.getId(), FrisquetRouter::kTous);
+        } else {
+            _routeur.ajouter(s.nomPhysique, s.satellite, FrisquetRouter::kTous, s.satellite.getId());
+        }
+    }
+
+    info("[RADIO] Table de routage : %d route(s).", _routeur.routes().size());
 }
 
 
+bool FrisquetManager::calibrerRadio(uint32_t palierMs) {
+    return _radio.calibration().demarrer(palierMs, [this](float decalageKHz, float bandeKHz) {
+        _cfg.radioOffsetKHz(decalageKHz);
+        _cfg.radioRxBandwidthKHz(bandeKHz);
+        _cfg.save();
+    });
+}
+
 bool FrisquetManager::recupererNetworkID() {
     byte buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
     size_t buffLength = 0;
@@ -233,7 +608,7 @@ bool FrisquetManager::recupererNetworkID() {
             NetworkID networkID;
         } donnees;
 
-        logRadio(true, (byte*)buff, buffLength);
+        radio().trames().enregistrer(true, buff, buffLength, radio().getRSSI(), RadioFrameLog::RECUE);
 
         ReadBuffer readBuffer = ReadBuffer(buff, buffLength);
         readBuffer.getBytes((byte*)&donnees, sizeof(donnees));
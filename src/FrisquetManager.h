@@ -9,14 +9,56 @@
 #include "DS18B20.h"
 #include "Frisquet/Satellite.h"
 #include "Frisquet/Zone.h"
+#include "Frisquet/FrisquetRouter.h"
+#include "MessageQueue.h"
 
 class FrisquetManager {
 public:
   FrisquetManager(FrisquetRadio& radio, Config& cfg, MqttManager& mqtt);
 
+  // Cœur de loopTask : sur le cœur 0, la tâche WiFi (priorité 23) et lwIP préempteraient la radio.
+  // Priorité au-dessus de loopTask (portail, MQTT) et de la sortie série des logs (1).
+  static constexpr uint8_t kTaskCore = ARDUINO_RUNNING_CORE;
+  static constexpr UBaseType_t kTaskPriority = 3;
+  static constexpr uint32_t kTaskStackSize = 8192;
+  static constexpr uint32_t kTaskIdleMs = 10;       // Réveil périodique pour les relances et échéances
+  static constexpr uint32_t kDiagnosticsMs = 60000; // Publication MQTT de la qualité des liaisons radio
+
   void begin();
   void loop();
 
+  // Lance la pile radio sur sa propre tâche FreeRTOS
+  bool startTask();
+  bool isTaskRunning() const { return _task != nullptr; }
+
+  // Demandes du portail, exécutées sur la tâche radio : les données sont copiées dans la
+  // commande et l'appelant attend le résultat au plus le délai de la commande.
+  // kErrTacheIndisponible si la file est pleine ou la tâche arrêtée, kErrDelaiDepasse sans résultat.
+  static constexpr int16_t kErrTacheIndisponible = -1300;
+  static constexpr int16_t kErrDelaiDepasse = -1301;
+  static constexpr uint32_t kAttenteFileMs = 200;           // Place dans la file de commandes
+  static constexpr uint32_t kAttenteCommandeMs = 2000;      // Émission, calibration
+  static constexpr uint32_t kAttenteLectureMs = RadioTransactionEngine::kDefaultQueueTimeoutMs + RadioTransactionEngine::kDefaultTimeoutMs + 1000;
+  static constexpr uint32_t kAttenteAssociationMs = 35000;  // Écoute de 30 s de FrisquetDevice::associer
+  static constexpr size_t kTrameMax = 100;
+
+  enum class APPAREIL : uint8_t {
+    CONNECT,
+    SONDE_EXTERIEURE,
+    SATELLITE_Z1,
+    SATELLITE_Z2,
+    SATELLITE_Z3
+  };
+
+  // Réponse brute de la chaudière (en-tête compris) dans reponse, length en entrée : taille du tampon
+  int16_t demanderLectureMemoire(uint8_t idExpediteur, uint8_t idAssociation, uint8_t idMessage, uint16_t adresse, uint16_t taille,
+                                 uint8_t retry, byte* reponse, size_t& length);
+  int16_t demanderEmission(const byte* payload, size_t length);
+  int16_t demanderAssociation(APPAREIL appareil);
+  int16_t demanderRecuperationNetworkID();
+  int16_t demanderCalibration(uint32_t palierMs);             // RADIOLIB_ERR_UNKNOWN si déjà en cours
+  int16_t demanderAnnulationCalibration();
+
   void initMqtt();
   void initDS18B20();
 
@@ -28,9 +70,13 @@ public:
   Satellite& satelliteZ1() { return _satelliteZ1; }
   Satellite& satelliteZ2() { return _satelliteZ2; }
   Satellite& satelliteZ3() { return _satelliteZ3; }
+  FrisquetRouter& routeur() { return _routeur; }
 
   bool recupererNetworkID();
 
+  // Balayage fréquence/bande passante ; le réglage retenu est enregistré dans la configuration
+  bool calibrerRadio(uint32_t palierMs);
+
 private:
   FrisquetRadio& _radio;
   Config&        _cfg;
@@ -49,15 +95,75 @@ private:
 
   DS18B20* _ds18b20;
 
-  void onRadioReceive();
-
-
-  bool _envoiZ1 = false;
-  bool _envoiZ2 = false;
-  bool _envoiZ3 = false;
+  // Commande transmise à la tâche radio, données copiées par valeur
+  struct Command {
+    enum Type : uint8_t {
+      LECTURE_MEMOIRE,
+      EMISSION,
+      ASSOCIATION,
+      RECUPERATION_NETWORKID,
+      CALIBRATION,
+      ANNULATION_CALIBRATION
+    };
+    Type type;
+    uint32_t id;
+    union {
+      struct {
+        uint8_t idExpediteur;
+        uint8_t idAssociation;
+        uint8_t idMessage;
+        uint8_t retry;
+        uint16_t adresse;
+        uint16_t taille;
+      } lecture;
+      struct {
+        uint8_t length;
+        byte payload[kTrameMax];
+      } emission;
+      APPAREIL appareil;
+      uint32_t palierMs;
+    };
+  };
+
+  // Résultat renvoyé au portail, associé à sa commande par id
+  struct Result {
+    uint32_t id;
+    int16_t err;
+    uint8_t length;
+    byte donnees[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+  };
+
+  TaskHandle_t _task = nullptr;
+  MessageQueue<Command> _commands{4};
+  MessageQueue<Result> _results{2};
+  uint32_t _commandId = 0;
+
+  // Envoi d'une commande et attente de son résultat (un seul appelant à la fois : le portail)
+  int16_t demander(Command& command, uint32_t attenteMs, Result* result = nullptr);
+  void executer(const Command& command);
+  void repondre(uint32_t id, int16_t err, const byte* donnees = nullptr, size_t length = 0);
+  template <typename T> bool associer(T& appareil);
+
+  static void taskMain(void* param);
+  void processCommands();
+
+  void initRoutes();
+  void onRadioReceive(RadioFrame& frame);
+
+  FrisquetRouter _routeur;
+
+  void publierDiagnostics();
 
   // MQTT
   MqttDevice _device;
+  struct {
+    MqttEntity rssiChaudiere;
+    MqttEntity succesChaudiere;
+    MqttEntity latenceChaudiere;
+    MqttEntity delaiAccuse;
+    MqttEntity depassementsAccuse;
+  } _mqttDiagnostics;
+  uint32_t _lastDiagnostics = 0;
 
   
 };
@@ -0,0 +1,84 @@
+#include "LogArchive.h"
+#include <LittleFS.h>
+
+bool LogArchive::begin() {
+  // Partition réservée aux journaux, formatée au premier démarrage
+  if (!LittleFS.begin(true, kRepertoire, 5, kPartition)) {
+    error("[ARCHIVE] Montage de la partition %s impossible, logs non conservés.", kPartition);
+    return false;
+  }
+  _monte = true;
+
+  if (!_store.begin()) {
+    error("[ARCHIVE] Ouverture des segments impossible, logs non conservés.");
+    return false;
+  }
+  info("[ARCHIVE] Journal persistant : %u octets conservés.", (uint32_t)_store.octetsStockes());
+  return true;
+}
+
+void LogArchive::loop() {
+  if (!_store.estActif()) {
+    return;
+  }
+  uint32_t now = millis();
+
+  Logs::Line line;
+  for (size_t n = 0; n < kLotEntrees; ++n) {
+    uint32_t attendu = _seqLogs;
+    if (!logs.lire(_seqLogs, line)) {
+      break;
+    }
+    _perdues += line.seq - attendu;
+
+    Logs::NIVEAU niveau = Logs::niveauDe(line.level);
+    if (niveau == Logs::DEBOGAGE) {
+      continue;
+    }
+    _store.ajouter(LogStore::JOURNAL, niveau, line.time, (const uint8_t*)line.message, strlen(line.message));
+    if (niveau == Logs::ERREUR && !_erreurEnAttente) {
+      _erreurEnAttente = true;
+      _erreurDepuisMs = now;
+    }
+  }
+
+  RadioFrameLog::Filtre toutes;
+  RadioFrameLog::Trame trame;
+  for (size_t n = 0; n < kLotEntrees; ++n) {
+    uint32_t attendu = _seqTrames;
+    if (!_trames.lire(_seqTrames, trame, toutes)) {
+      break;
+    }
+    if (now - trame.millis < kDelaiTrameMs) {   // Issue pas encore qualifiée : relue au prochain tour
+      _seqTrames = trame.seq;
+      break;
+    }
+    _perdues += trame.seq - attendu;
+
+    // RSSI (dixièmes de dBm) et issue, puis la trame brute
+    uint8_t donnees[3 + RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    int16_t rssi = isnan(trame.rssi) ? INT16_MIN : (int16_t)lroundf(trame.rssi * 10);
+    memcpy(donnees, &rssi, sizeof(rssi));
+    donnees[2] = trame.issue;
+    memcpy(&donnees[3], trame.donnees, trame.length);
+    _store.ajouter(LogStore::TRAME, trame.rx ? 1 : 0, trame.time, donnees, 3 + trame.length);
+  }
+
+  if (_erreurEnAttente && now - _erreurDepuisMs >= kDelaiErreurMs) {
+    _erreurEnAttente = false;
+    _store.ecrire();
+  }
+  _store.loop(now);
+}
+
+void LogArchive::flush() {
+  _store.ecrire();
+}
+
+void LogArchive::end() {
+  _store.end();
+  if (_monte) {
+    LittleFS.end();
+    _monte = false;
+  }
+}
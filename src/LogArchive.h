@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+#include "LogStore.h"
+#include "Logs.h"
+#include "Frisquet/RadioFrameLog.h"
+
+// Archive en flash des logs et des trames radio, conservée après un redémarrage ou une
+// mise à jour : les nouvelles entrées de Logs et de RadioFrameLog sont relues par leur
+// curseur et ajoutées au LogStore monté sur LittleFS (partition de données "spiffs").
+// Les lignes DEBUG ne sont pas archivées.
+class LogArchive {
+public:
+  static constexpr const char* kPartition = "spiffs";
+  static constexpr const char* kRepertoire = "/littlefs";
+  static constexpr size_t kLotEntrees = 32;                 // Entrées archivées au plus par tour de boucle
+  static constexpr uint32_t kDelaiErreurMs = 5000;          // Après une erreur, tampon écrit sans attendre kDelaiEcritureMs
+  static constexpr uint32_t kDelaiTrameMs = 1000;           // Trame archivée une fois son issue connue
+
+  explicit LogArchive(RadioFrameLog& trames) : _store(kRepertoire), _trames(trames) {}
+
+  bool begin();
+  void loop();
+
+  // Écriture du tampon avant un redémarrage ; end() démonte aussi la partition (mise à jour du système de fichiers)
+  void flush();
+  void end();
+
+  LogStore& store() { return _store; }
+  uint32_t perdues() const { return _perdues; }
+
+private:
+  LogStore _store;
+  RadioFrameLog& _trames;
+  bool _monte = false;
+  uint32_t _seqLogs = 1;
+  uint32_t _seqTrames = 1;
+  uint32_t _perdues = 0;          // Entrées oubliées des journaux en RAM avant d'être archivées
+  uint32_t _erreurDepuisMs = 0;
+  bool _erreurEnAttente = false;
+};
@@ -0,0 +1,311 @@
+#include "LogStore.h"
+#include <stdio.h>
+#include <string.h>
+
+std::string LogStore::chemin(size_t segment) const {
+    char nom[16];
+    snprintf(nom, sizeof(nom), "/logs%u.bin", (unsigned)segment);
+    return _repertoire + nom;
+}
+
+bool LogStore::relire(size_t index, size_t& fichier) {
+    Segment& segment = _segments[index];
+    segment = Segment();
+    fichier = 0;
+
+    FILE* f = fopen(chemin(index).c_str(), "rb");
+    if(!f) {
+        return false;
+    }
+
+    EnteteSegment entete;
+    if(fread(&entete, sizeof(entete), 1, f) != 1 || entete.magie != kMagie) {
+        fclose(f);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    fichier = ftell(f);
+    fseek(f, sizeof(entete), SEEK_SET);
+
+    // Fin valide : dernier enregistrement complet et marqué
+    size_t taille = sizeof(entete);
+    EnteteEnregistrement e;
+    while(fread(&e, sizeof(e), 1, f) == 1) {
+        if(e.marque != kMarque || e.length > kMaxDonnees || taille + sizeof(e) + e.length > fichier) {
+            break;
+        }
+        fseek(f, e.length, SEEK_CUR);
+        taille += sizeof(e) + e.length;
+        segment.premier = e.time < segment.premier ? e.time : segment.premier;
+        segment.dernier = e.time > segment.dernier ? e.time : segment.dernier;
+    }
+    fclose(f);
+
+    segment.valide = true;
+    segment.numero = entete.numero;
+    segment.taille = taille;
+    return true;
+}
+
+bool LogStore::begin() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    bool trouve = false;
+    _courant = 0;   // Aucun segment : le premier est créé à l'emplacement 0
+    for(size_t i = 0; i < kSegments; i++) {
+        size_t fichier;
+        if(!relire(i, fichier)) {
+            continue;
+        }
+        // Jamais d'ajout derrière une fin d'écriture interrompue
+        _segments[i].abime = fichier != _segments[i].taille;
+        if(!trouve || _segments[i].numero > _segments[_courant].numero) {
+            _courant = i;
+        }
+        _numero = _segments[i].numero > _numero ? _segments[i].numero : _numero;
+        trouve = true;
+    }
+
+    _actif = true;
+    if(!trouve || _segments[_courant].abime) {
+        return tourner();
+    }
+    return true;
+}
+
+bool LogStore::tourner() {
+    // Un segment courant sans enregistrement (rotation ou écriture précédente en échec) est
+    // réutilisé plutôt que d'effacer le plus ancien : une erreur durable (partition pleine)
+    // ne coûte qu'un segment, pas tout l'historique
+    if(_segments[_courant].valide && _segments[_courant].taille > sizeof(EnteteSegment)) {
+        _courant = (_courant + 1) % kSegments;
+        ++_stats.rotations;
+    }
+    uint32_t numero = ++_numero;
+
+    Segment& segment = _segments[_courant];
+    segment = Segment();
+    FILE* f = fopen(chemin(_courant).c_str(), "wb");
+    if(!f) {
+        ++_stats.erreurs;
+        return false;
+    }
+    EnteteSegment entete = { kMagie, numero };
+    bool ok = fwrite(&entete, sizeof(entete), 1, f) == 1;
+    ok = fclose(f) == 0 && ok;
+    if(!ok) {
+        ++_stats.erreurs;
+        return false;
+    }
+
+    segment.valide = true;
+    segment.numero = numero;
+    segment.taille = sizeof(entete);
+    return true;
+}
+
+bool LogStore::ajouter(GENRE genre, uint8_t attribut, uint32_t time, const uint8_t* donnees, size_t length) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_actif) {
+        return false;
+    }
+
+    length = length < kMaxDonnees ? length : kMaxDonnees;
+    EnteteEnregistrement e = {};
+    e.time = time;
+    e.length = length;
+    e.marque = kMarque;
+    e.genre = genre;
+    e.attribut = attribut;
+
+    // Tampon plein : écrit d'abord, sauf pendant une série d'échecs (reprise par loop())
+    if(kTamponOctets - _tamponLongueur < sizeof(e) + length && !_enEchec) {
+        ecrireVerrouille();
+    }
+    if(kTamponOctets - _tamponLongueur < sizeof(e) + length) {
+        ++_stats.rejetes;
+        return false;
+    }
+    memcpy(&_tampon[_tamponLongueur], &e, sizeof(e));
+    memcpy(&_tampon[_tamponLongueur + sizeof(e)], donnees, length);
+    _tamponLongueur += sizeof(e) + length;
+    _tamponPremier = time < _tamponPremier ? time : _tamponPremier;
+    _tamponDernier = time > _tamponDernier ? time : _tamponDernier;
+    ++_stats.enregistrements;
+    return true;
+}
+
+void LogStore::loop(uint32_t nowMs) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_tamponLongueur == 0) {
+        _enAttente = false;
+        return;
+    }
+    if(!_enAttente) {
+        _enAttente = true;
+        _attenteDepuisMs = nowMs;
+        return;
+    }
+    if(nowMs - _attenteDepuisMs >= kDelaiEcritureMs && !ecrireVerrouille()) {
+        _attenteDepuisMs = nowMs;   // Nouvel essai après le même délai
+    }
+}
+
+bool LogStore::ecrire() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return ecrireVerrouille();
+}
+
+void LogStore::end() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ecrireVerrouille();
+    _actif = false;
+}
+
+bool LogStore::ecrireVerrouille() {
+    if(!_actif || _tamponLongueur == 0) {
+        return true;
+    }
+
+    // Le tampon n'est jamais coupé entre deux segments ; après un échec, la fin du segment
+    // est incertaine et l'écriture reprend sur un segment neuf
+    Segment& courant = _segments[_courant];
+    if(!courant.valide || courant.abime || courant.taille + _tamponLongueur > kSegmentOctets) {
+        if(!tourner()) {
+            _enEchec = true;
+            return false;
+        }
+    }
+
+    Segment& segment = _segments[_courant];
+    FILE* f = fopen(chemin(_courant).c_str(), "ab");
+    bool ok = f != nullptr;
+    if(f) {
+        ok = fwrite(_tampon, 1, _tamponLongueur, f) == _tamponLongueur;
+        ok = fclose(f) == 0 && ok;
+    }
+    if(!ok) {
+        ++_stats.erreurs;
+        segment.abime = true;
+        _enEchec = true;
+        return false;
+    }
+
+    segment.taille += _tamponLongueur;
+    segment.premier = _tamponPremier < segment.premier ? _tamponPremier : segment.premier;
+    segment.dernier = _tamponDernier > segment.dernier ? _tamponDernier : segment.dernier;
+    ++_stats.ecritures;
+    _stats.octetsEcrits += _tamponLongueur;
+
+    _tamponLongueur = 0;
+    _tamponPremier = UINT32_MAX;
+    _tamponDernier = 0;
+    _enAttente = false;
+    _enEchec = false;
+    return true;
+}
+
+bool LogStore::parcourirTampon(const uint8_t* tampon, size_t length, uint32_t debut, uint32_t fin, const Visiteur& visiteur) {
+    size_t pos = 0;
+    while(pos + sizeof(EnteteEnregistrement) <= length) {
+        EnteteEnregistrement e;
+        memcpy(&e, &tampon[pos], sizeof(e));
+        if(e.marque != kMarque || pos + sizeof(e) + e.length > length) {
+            break;
+        }
+        if(e.time >= debut && e.time <= fin) {
+            Enregistrement enregistrement = { (GENRE)e.genre, e.attribut, e.time, &tampon[pos + sizeof(e)], e.length };
+            if(!visiteur(enregistrement)) {
+                return false;
+            }
+        }
+        pos += sizeof(e) + e.length;
+    }
+    return true;
+}
+
+bool LogStore::parcourirSegment(size_t index, uint32_t debut, uint32_t fin, const Visiteur& visiteur) {
+    const Segment& segment = _segments[index];
+    FILE* f = fopen(chemin(index).c_str(), "rb");
+    if(!f) {
+        return true;
+    }
+    fseek(f, sizeof(EnteteSegment), SEEK_SET);
+
+    // Lecture par blocs : au plus un enregistrement coupé, repris en tête du bloc suivant
+    uint8_t bloc[1024];
+    size_t restant = segment.taille - sizeof(EnteteSegment);
+    size_t dispo = 0;
+    bool continuer = true;
+    while(continuer && restant > 0) {
+        size_t n = fread(&bloc[dispo], 1, (sizeof(bloc) - dispo) < restant ? sizeof(bloc) - dispo : restant, f);
+        if(n == 0) {
+            break;
+        }
+        restant -= n;
+        dispo += n;
+
+        size_t pos = 0;
+        while(pos + sizeof(EnteteEnregistrement) <= dispo) {
+            EnteteEnregistrement e;
+            memcpy(&e, &bloc[pos], sizeof(e));
+            if(pos + sizeof(e) + e.length > dispo) {
+                break;
+            }
+            if(e.time >= debut && e.time <= fin) {
+                Enregistrement enregistrement = { (GENRE)e.genre, e.attribut, e.time, &bloc[pos + sizeof(e)], e.length };
+                if(!visiteur(enregistrement)) {
+                    continuer = false;
+                    break;
+                }
+            }
+            pos += sizeof(e) + e.length;
+        }
+        memmove(bloc, &bloc[pos], dispo - pos);
+        dispo -= pos;
+    }
+    fclose(f);
+    return continuer;
+}
+
+void LogStore::parcourir(uint32_t debut, uint32_t fin, Visiteur visiteur) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(!_actif) {
+        return;
+    }
+
+    // Du segment le plus ancien au courant, en écartant ceux hors de l'intervalle
+    size_t ordre[kSegments];
+    size_t nombre = 0;
+    for(size_t i = 0; i < kSegments; i++) {
+        if(!_segments[i].valide) {
+            continue;
+        }
+        size_t j = nombre++;
+        while(j > 0 && _segments[ordre[j - 1]].numero > _segments[i].numero) {
+            ordre[j] = ordre[j - 1];
+            --j;
+        }
+        ordre[j] = i;
+    }
+
+    for(size_t k = 0; k < nombre; k++) {
+        const Segment& segment = _segments[ordre[k]];
+        if(segment.premier > fin || segment.dernier < debut) {
+            continue;
+        }
+        if(!parcourirSegment(ordre[k], debut, fin, visiteur)) {
+            return;
+        }
+    }
+    parcourirTampon(_tampon, _tamponLongueur, debut, fin, visiteur);
+}
+
+size_t LogStore::octetsStockes() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t total = 0;
+    for(const Segment& segment : _segments) {
+        total += segment.valide ? segment.taille : 0;
+    }
+    return total;
+}
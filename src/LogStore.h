@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <mutex>
+#include <string>
+
+// Journal persistant à écriture seule, sans dépendance Arduino : une rotation de
+// kSegments fichiers de kSegmentOctets au plus. Les enregistrements sont groupés en
+// RAM et écrits par tampon entier (une écriture par tampon plein ou par échéance), le
+// segment le plus ancien est effacé quand le courant est plein. Sur la carte, les
+// fichiers sont sur LittleFS (répartition de l'usure) ; sur poste de développement,
+// n'importe quel répertoire convient : Sim/LogStoreBench.cpp en mesure le débit d'écriture.
+class LogStore {
+    public:
+        static constexpr size_t kSegments = 8;
+        static constexpr size_t kSegmentOctets = 65536;
+        static constexpr size_t kTamponOctets = 4096;
+        static constexpr uint32_t kDelaiEcritureMs = 60000;    // Tampon partiel écrit au plus tard après ce délai
+        static constexpr size_t kMaxDonnees = 300;
+
+        enum GENRE : uint8_t {
+            JOURNAL,    // Ligne de log ; attribut : niveau
+            TRAME       // Trame radio ; attribut : 1 en réception
+        };
+
+        struct Enregistrement {
+            GENRE genre;
+            uint8_t attribut;
+            uint32_t time;
+            const uint8_t* donnees;
+            size_t length;
+        };
+
+        // Retourne false pour arrêter le parcours
+        typedef std::function<bool(const Enregistrement& enregistrement)> Visiteur;
+
+        struct Stats {
+            uint32_t enregistrements = 0;
+            uint32_t ecritures = 0;         // Tampons écrits
+            uint32_t octetsEcrits = 0;
+            uint32_t rotations = 0;
+            uint32_t erreurs = 0;
+            uint32_t rejetes = 0;           // Enregistrements abandonnés : tampon plein et écriture impossible
+        };
+
+        explicit LogStore(const char* repertoire) : _repertoire(repertoire) {}
+
+        // Relit les segments existants ; un segment courant tronqué (coupure pendant
+        // une écriture) est abandonné au profit d'un nouveau
+        bool begin();
+
+        // Ajout en RAM ; le tampon est écrit d'abord s'il n'a plus la place. false si
+        // l'enregistrement est abandonné (écriture en échec, tampon toujours plein)
+        bool ajouter(GENRE genre, uint8_t attribut, uint32_t time, const uint8_t* donnees, size_t length);
+
+        // Écrit le tampon à échéance (kDelaiEcritureMs depuis le premier ajout en attente),
+        // puis toutes les kDelaiEcritureMs tant que l'écriture échoue
+        void loop(uint32_t nowMs);
+
+        // Écriture immédiate du tampon (redémarrage, mise à jour)
+        bool ecrire();
+
+        // Écriture du tampon, puis plus aucun accès aux fichiers (démontage de la partition)
+        void end();
+
+        // Enregistrements dont l'horodatage est dans [debut, fin], du plus ancien au plus
+        // récent, tampon compris
+        void parcourir(uint32_t debut, uint32_t fin, Visiteur visiteur);
+
+        const Stats& stats() const { return _stats; }
+        size_t octetsStockes();
+        size_t enAttente() const { return _tamponLongueur; }
+        bool estActif() const { return _actif; }
+
+    private:
+        static constexpr uint32_t kMagie = 0x4C4F4731;     // "LOG1"
+        static constexpr uint8_t kMarque = 0xA5;
+
+        struct EnteteSegment {
+            uint32_t magie;
+            uint32_t numero;        // Croissant : ordre des segments
+        };
+
+        struct EnteteEnregistrement {
+            uint32_t time;
+            uint16_t length;
+            uint8_t marque;
+            uint8_t genre;
+            uint8_t attribut;
+        };
+
+        struct Segment {
+            bool valide = false;
+            uint32_t numero = 0;
+            size_t taille = 0;      // Octets valides, en-tête compris
+            uint32_t premier = UINT32_MAX;  // Horodatages extrêmes (l'heure peut reculer avant la synchro NTP)
+            uint32_t dernier = 0;
+            bool abime = false;     // Fin de fichier au-delà de taille incertaine : plus d'ajout
+        };
+
+        std::string chemin(size_t segment) const;
+        bool relire(size_t segment, size_t& fichier);
+        bool parcourirSegment(size_t segment, uint32_t debut, uint32_t fin, const Visiteur& visiteur);
+        bool parcourirTampon(const uint8_t* tampon, size_t length, uint32_t debut, uint32_t fin, const Visiteur& visiteur);
+        bool tourner();
+        bool ecrireVerrouille();
+
+        std::string _repertoire;
+        Segment _segments[kSegments];
+        size_t _courant = 0;
+        uint32_t _numero = 0;       // Plus grand numéro de segment attribué
+        bool _actif = false;
+        bool _enEchec = false;      // Dernière écriture en échec
+
+        uint8_t _tampon[kTamponOctets];
+        size_t _tamponLongueur = 0;
+        uint32_t _tamponPremier = UINT32_MAX;
+        uint32_t _tamponDernier = 0;
+        uint32_t _attenteDepuisMs = 0;
+        bool _enAttente = false;
+
+        Stats _stats;
+        std::mutex _mutex;
+};
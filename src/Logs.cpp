@@ -3,10 +3,124 @@
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
+#include <ctype.h>
+#include <cstddef>
+#include <cstdint>
 #include <time.h>
 
 Logs logs;  // définition unique de l’instance globale
 
+namespace {
+
+// Conversion printf, analysée à l'écriture (empaquetage) puis à la lecture (mise en forme)
+struct Conversion {
+  enum TYPE : uint8_t {
+    AUCUN,
+    ENTIER,       // int32_t
+    ENTIER64,     // int64_t
+    REEL,         // double
+    CHAINE,       // octets copiés, terminés par '\0'
+    POINTEUR      // uintptr_t
+  };
+
+  const char* debut = nullptr;  // '%'
+  uint8_t etoiles = 0;          // Largeur/précision passées en argument
+  uint8_t longs = 0;            // Nombre de 'l'
+  char modificateur = '\0';     // Dernier modificateur de taille (h, l, L, z, j, t)
+  char conversion = '\0';
+  TYPE type = AUCUN;
+};
+
+const char* analyser(const char* p, Conversion& c) {
+  c = Conversion();
+  c.debut = p++;
+  while (*p && strchr("-+ #0", *p)) {
+    ++p;
+  }
+  if (*p == '*') {
+    ++c.etoiles;
+    ++p;
+  } else {
+    while (isdigit((unsigned char)*p)) ++p;
+  }
+  if (*p == '.') {
+    ++p;
+    if (*p == '*') {
+      ++c.etoiles;
+      ++p;
+    } else {
+      while (isdigit((unsigned char)*p)) ++p;
+    }
+  }
+  while (*p && strchr("hlLzjt", *p)) {
+    if (*p == 'l') {
+      ++c.longs;
+    }
+    c.modificateur = *p++;
+  }
+
+  c.conversion = *p;
+  switch (*p) {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+      c.type = (c.longs >= 2 || c.modificateur == 'j') ? Conversion::ENTIER64 : Conversion::ENTIER;
+      break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      c.type = Conversion::REEL;
+      break;
+    case 's':
+      c.type = Conversion::CHAINE;
+      break;
+    case 'p':
+      c.type = Conversion::POINTEUR;
+      break;
+    default:
+      c.type = Conversion::AUCUN;
+      break;
+  }
+  return *p ? p + 1 : p;
+}
+
+// Spécification équivalente pour un argument normalisé (largeur/précision résolues)
+void construireSpec(char* spec, size_t specSize, const Conversion& c, const int32_t* etoiles) {
+  size_t n = 0;
+  auto ajouter = [&](char ch) {
+    if (n + 1 < specSize) spec[n++] = ch;
+  };
+  auto ajouterNombre = [&](int32_t v) {
+    char nombre[12];
+    snprintf(nombre, sizeof(nombre), "%ld", (long)v);
+    for (const char* q = nombre; *q; ++q) ajouter(*q);
+  };
+
+  const char* p = c.debut;
+  ajouter(*p++);
+  uint8_t etoile = 0;
+  while (*p && strchr("-+ #0", *p)) ajouter(*p++);
+  if (*p == '*') {
+    ajouterNombre(etoiles[etoile++]);
+    ++p;
+  } else {
+    while (isdigit((unsigned char)*p)) ajouter(*p++);
+  }
+  if (*p == '.') {
+    ajouter(*p++);
+    if (*p == '*') {
+      ajouterNombre(etoiles[etoile++]);
+      ++p;
+    } else {
+      while (isdigit((unsigned char)*p)) ajouter(*p++);
+    }
+  }
+  if (c.type == Conversion::ENTIER64) {
+    ajouter('l');
+    ajouter('l');
+  }
+  ajouter(c.conversion);
+  spec[n] = '\0';
+}
+
+}  // namespace
+
 void Logs::Line::set(const char* levelIn, const char* messageIn, time_t t) {
   Logs::copyTruncate(level, sizeof(level), levelIn);
   Logs::copyTruncate(message, sizeof(message), messageIn);
@@ -46,96 +160,417 @@ void Logs::copyTruncate(char* dest, size_t destSize, const char* src) {
   dest[destSize - 1] = '\0';
 }
 
-void Logs::clear() {
-  //BusyGuard guard(*this);
-  _count = 0;
-  _head = 0;
+const char* Logs::nomNiveau(NIVEAU niveau) {
+  switch (niveau) {
+    case DEBOGAGE: return "DEBUG";
+    case INFORMATION: return "INFO";
+    case ERREUR: return "ERROR";
+    case AVERTISSEMENT: return "WARNING";
+    default: return "LOG";
+  }
 }
 
-void Logs::addLog(const char* level, const char* message) {
-  if (_capacity == 0) {
+Logs::NIVEAU Logs::niveauDe(const char* level) {
+  for (uint8_t n = DEBOGAGE; n < AUTRE; ++n) {
+    if (level && strcmp(level, nomNiveau((NIVEAU)n)) == 0) {
+      return (NIVEAU)n;
+    }
+  }
+  return AUTRE;
+}
+
+bool Logs::correspond(const Entete& entete, const char* level) {
+  if (!level || level[0] == '\0') {
+    return true;
+  }
+  return strncmp(nomNiveau((NIVEAU)entete.niveau), level, kMaxLevelLen) == 0;
+}
+
+void Logs::inserer(uint8_t* entree, size_t taille) {
+  Entete e;
+  memcpy(&e, entree, sizeof(e));
+  size_t offset = _arena.ajouter(e, entree + sizeof(Entete), taille - sizeof(Entete));
+  if (e.seq == _serieSeq) {   // Entrée attendue par la sortie série
+    _serieOffset = offset;
+  }
+}
+
+void Logs::mettreEnForme(const uint8_t* entree, Line& out) {
+  Entete e;
+  memcpy(&e, entree, sizeof(e));
+  const uint8_t* donnees = entree + sizeof(Entete);
+  size_t restant = e.taille - sizeof(Entete);
+
+  copyTruncate(out.level, sizeof(out.level), nomNiveau((NIVEAU)e.niveau));
+  out.time = e.time;
+  out.seq = e.seq;
+
+  if (e.genre == TEXTE) {
+    copyTruncate(out.message, sizeof(out.message), (const char*)donnees);
     return;
   }
-  char formatted[kMaxFormattedLen];
-  Line line;
-  line.set(level ? level : "", message ? message : "", now());
 
-  {
-    //BusyGuard guard(*this);
-    _entries[_head] = line;
-    _head = (_head + 1) % _capacity;
-    if (_count < _capacity) {
-      ++_count;
+  // Format relu avec les arguments empaquetés, une conversion à la fois
+  char* message = out.message;
+  size_t taille = sizeof(out.message);
+  size_t pos = 0;
+  auto lire = [&](void* valeur, size_t n) {
+    if (restant < n) {
+      return false;
+    }
+    memcpy(valeur, donnees, n);
+    donnees += n;
+    restant -= n;
+    return true;
+  };
+  auto avancer = [&](int ecrit) {
+    if (ecrit > 0) {
+      pos += (size_t)ecrit < taille - pos ? (size_t)ecrit : taille - pos - 1;
+    }
+  };
+
+  const char* p = e.fmt;
+  while (*p && pos + 1 < taille) {
+    if (*p != '%') {
+      message[pos++] = *p++;
+      continue;
+    }
+    if (p[1] == '%') {
+      message[pos++] = '%';
+      p += 2;
+      continue;
+    }
+
+    Conversion c;
+    p = analyser(p, c);
+    if (c.type == Conversion::AUCUN) {
+      continue;
     }
+
+    int32_t etoiles[2] = {0, 0};
+    bool complet = true;
+    for (uint8_t i = 0; i < c.etoiles; ++i) {
+      complet = complet && lire(&etoiles[i], sizeof(int32_t));
+    }
+
+    char spec[24];
+    construireSpec(spec, sizeof(spec), c, etoiles);
+    switch (c.type) {
+      case Conversion::ENTIER: {
+        int32_t v;
+        if (complet && lire(&v, sizeof(v))) { avancer(snprintf(message + pos, taille - pos, spec, (int)v)); continue; }
+        break;
+      }
+      case Conversion::ENTIER64: {
+        int64_t v;
+        if (complet && lire(&v, sizeof(v))) { avancer(snprintf(message + pos, taille - pos, spec, (long long)v)); continue; }
+        break;
+      }
+      case Conversion::REEL: {
+        double v;
+        if (complet && lire(&v, sizeof(v))) { avancer(snprintf(message + pos, taille - pos, spec, v)); continue; }
+        break;
+      }
+      case Conversion::CHAINE: {
+        const char* v = (const char*)donnees;
+        size_t n = strnlen(v, restant);
+        if (complet && n < restant) {
+          avancer(snprintf(message + pos, taille - pos, spec, v));
+          donnees += n + 1;
+          restant -= n + 1;
+          continue;
+        }
+        break;
+      }
+      case Conversion::POINTEUR: {
+        uintptr_t v;
+        if (complet && lire(&v, sizeof(v))) { avancer(snprintf(message + pos, taille - pos, spec, (void*)v)); continue; }
+        break;
+      }
+      default:
+        break;
+    }
+
+    // Arguments tronqués à l'écriture
+    avancer(snprintf(message + pos, taille - pos, "..."));
+    break;
   }
+  message[pos < taille ? pos : taille - 1] = '\0';
+}
 
-  line.format(formatted, sizeof(formatted));
-  Serial.println(formatted);
+void Logs::clear() {
+  Arena::Verrou guard(_arena);
+  _arena.vider();
+}
+
+void Logs::addLog(const char* level, const char* message) {
+  uint8_t entree[kMaxRecordLen];
+  Entete e;
+  e.niveau = niveauDe(level);
+  e.genre = TEXTE;
+  e.time = now();
+  e.fmt = nullptr;
+  memcpy(entree, &e, sizeof(e));
+
+  size_t maximum = kMaxMessageLen < kMaxRecordLen - sizeof(Entete) ? kMaxMessageLen : kMaxRecordLen - sizeof(Entete);
+  size_t n = message ? strnlen(message, maximum - 1) : 0;
+  memcpy(entree + sizeof(Entete), message ? message : "", n);
+  entree[sizeof(Entete) + n] = '\0';
+
+  {
+    Arena::Verrou guard(_arena);
+    inserer(entree, sizeof(Entete) + n + 1);
+  }
 }
 
 void Logs::addLogf(const char* level, const char* fmt, ...) {
-  char buffer[kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  addLogv(niveauDe(level), fmt, args);
   va_end(args);
-  addLog(level, buffer);
 }
 
-size_t Logs::getLogCount(const char* level) {
-  if (_capacity == 0) {
-    return 0;
+void Logs::addLogv(NIVEAU niveau, const char* fmt, va_list args) {
+  uint8_t entree[kMaxRecordLen];
+  Entete e;
+  e.niveau = niveau;
+  e.genre = FORMAT;
+  e.time = now();
+  e.fmt = fmt ? fmt : "";
+  memcpy(entree, &e, sizeof(e));
+
+  // Arguments copiés selon les conversions du format, sans mise en forme
+  size_t pos = sizeof(Entete);
+  bool tronque = false;
+  auto ecrire = [&](const void* valeur, size_t n) {
+    if (tronque || pos + n > sizeof(entree)) {
+      tronque = true;
+      return;
+    }
+    memcpy(entree + pos, valeur, n);
+    pos += n;
+  };
+
+  const char* p = e.fmt;
+  while (*p && !tronque) {
+    if (*p != '%') {
+      ++p;
+      continue;
+    }
+    if (p[1] == '%') {
+      p += 2;
+      continue;
+    }
+
+    Conversion c;
+    p = analyser(p, c);
+    for (uint8_t i = 0; i < c.etoiles; ++i) {
+      int32_t v = va_arg(args, int);
+      ecrire(&v, sizeof(v));
+    }
+
+    switch (c.type) {
+      case Conversion::ENTIER: {
+        int32_t v;
+        if (c.modificateur == 'l') v = va_arg(args, long);
+        else if (c.modificateur == 'z') v = va_arg(args, size_t);
+        else if (c.modificateur == 't') v = va_arg(args, ptrdiff_t);
+        else v = va_arg(args, int);
+        ecrire(&v, sizeof(v));
+        break;
+      }
+      case Conversion::ENTIER64: {
+        int64_t v = c.modificateur == 'j' ? (int64_t)va_arg(args, intmax_t) : (int64_t)va_arg(args, long long);
+        ecrire(&v, sizeof(v));
+        break;
+      }
+      case Conversion::REEL: {
+        double v = c.modificateur == 'L' ? (double)va_arg(args, long double) : va_arg(args, double);
+        ecrire(&v, sizeof(v));
+        break;
+      }
+      case Conversion::CHAINE: {
+        const char* v = va_arg(args, const char*);
+        if (!v) v = "(null)";
+        size_t n = strnlen(v, kMaxStringArg - 1);
+        if (pos + n + 1 > sizeof(entree)) {
+          n = pos + 1 < sizeof(entree) ? sizeof(entree) - pos - 1 : 0;
+          tronque = true;
+        }
+        if (pos < sizeof(entree)) {
+          memcpy(entree + pos, v, n);
+          entree[pos + n] = '\0';
+          pos += n + 1;
+        }
+        break;
+      }
+      case Conversion::POINTEUR: {
+        uintptr_t v = (uintptr_t)va_arg(args, void*);
+        ecrire(&v, sizeof(v));
+        break;
+      }
+      default:
+        if (c.conversion == 'n') {
+          (void)va_arg(args, int*);
+        }
+        break;
+    }
   }
-  //BusyGuard guard(*this);
-  if (!level || level[0] == '\0') {
-    return _count;
+
+  {
+    Arena::Verrou guard(_arena);
+    inserer(entree, pos);
   }
-  size_t count = 0;
-  for (size_t i = 0; i < _count; ++i) {
-    size_t idx = (_head + _capacity - _count + i) % _capacity;
-    if (_entries[idx].levelEquals(level)) {
-      ++count;
+}
+
+size_t Logs::getLogCount(const char* level) {
+  Arena::Verrou guard(_arena);
+  return _arena.compter([level](const Entete& e, size_t) { return correspond(e, level); });
+}
+
+bool Logs::lire(uint32_t& seq, Line& out, const char* level) {
+  uint8_t entree[kMaxRecordLen];
+  {
+    Arena::Verrou guard(_arena);
+    size_t offset;
+    if (!_arena.trouver(seq, [level](const Entete& e, size_t) { return correspond(e, level); }, offset)) {
+      seq = _arena.prochainSeq();   // Rien de plus pour ce niveau : inutile de reparcourir ces entrées
+      return false;
     }
+    Entete e = _arena.entete(offset);
+    memcpy(entree, _arena.entree(offset), e.taille);
+    seq = e.seq + 1;
+  }
+
+  // Mise en forme hors verrou : la tâche radio n'attend pas le portail
+  mettreEnForme(entree, out);
+  return true;
+}
+
+uint32_t Logs::chercherDebut(size_t limit, const char* level) {
+  Arena::Verrou guard(_arena);
+  return _arena.chercherDebut(limit, [level](const Entete& e, size_t) { return correspond(e, level); });
+}
+
+uint32_t Logs::prochainSeq() {
+  Arena::Verrou guard(_arena);
+  return _arena.prochainSeq();
+}
+
+bool Logs::startSerialTask() {
+  if (_serialTask != nullptr) {
+    return true;
+  }
+  if (xTaskCreatePinnedToCore(Logs::serialTaskMain, "logs", kSerialTaskStackSize, this, kSerialTaskPriority, &_serialTask, kSerialTaskCore) != pdPASS) {
+    _serialTask = nullptr;
+    return false;
   }
-  return count;
+  return true;
 }
 
-size_t Logs::getLines(Line* out, size_t outCapacity, size_t limit, const char* level) {
-  if (!out || outCapacity == 0 || limit == 0 || _capacity == 0) {
-    return 0;
+void Logs::serialTaskMain(void* param) {
+  Logs* owner = static_cast<Logs*>(param);
+  for (;;) {
+    owner->drainSerial();
+    vTaskDelay(pdMS_TO_TICKS(kSerialIdleMs));
   }
+}
 
-  //BusyGuard guard(*this);
-  if (_count == 0) {
-    return 0;
+uint32_t Logs::serialBacklog() {
+  Arena::Verrou guard(_arena);
+  return _arena.prochainSeq() - _serieSeq;
+}
+
+bool Logs::prochaineSerie(uint8_t* entree, uint32_t& attente) {
+  Arena::Verrou guard(_arena);
+  uint32_t premier = _arena.premierSeq();
+  if (_serieSeq < premier) {  // Écrasées dans l'arène avant d'avoir été écrites
+    _seriePerdues += premier - _serieSeq;
+    _serieSeq = premier;
+    _serieOffset = _arena.premiere();
   }
+  if (_serieSeq >= _arena.prochainSeq()) {
+    return false;
+  }
+
+  attente = _arena.prochainSeq() - _serieSeq;
+  memcpy(entree, _arena.entree(_serieOffset), _arena.entete(_serieOffset).taille);
+  ++_serieSeq;
+  if (_serieSeq < _arena.prochainSeq()) {
+    _serieOffset = _arena.suivante(_serieOffset);
+  }
+  return true;
+}
 
-  bool filterByLevel = level && level[0] != '\0';
-  size_t maxOut = limit < outCapacity ? limit : outCapacity;
-  size_t outCount = 0;
+bool Logs::omettreSerie(NIVEAU niveau, uint32_t attente) {
+  _serieSaturee = attente > kMaxSerialBacklog;
+  if (!_serieSaturee) {
+    return false;
+  }
 
-  for (size_t i = 0; i < _count && outCount < maxOut; ++i) {
-    size_t idx = (_head + _capacity - 1 - i) % _capacity;
-    const Line& line = _entries[idx];
+  // Saturée : erreurs et avertissements conservés, INFO échantillonné, DEBUG omis
+  switch (niveau) {
+    case ERREUR:
+    case AVERTISSEMENT:
+    case AUTRE:
+      return false;
+    case INFORMATION:
+      return _serieEchantillon++ % kSerialInfoSampling != 0;
+    default:
+      return true;
+  }
+}
 
-    if (filterByLevel) {
-      if (!line.levelEquals(level)) {
-        continue;
+void Logs::drainSerial() {
+  for (;;) {
+    // Ligne en cours : seulement ce que le tampon d'émission accepte sans attendre
+    if (_seriePos < _serieLongueur) {
+      int place = Serial.availableForWrite();
+      if (place <= 0) {
+        return;
       }
-    } else if (line.levelEquals("RADIO")) {
+      size_t n = _serieLongueur - _seriePos;
+      n = n < (size_t)place ? n : (size_t)place;
+      Serial.write((const uint8_t*)&_serieLigne[_seriePos], n);
+      _seriePos += n;
       continue;
     }
 
-    out[outCount++] = line;
-  }
+    // Retour sous le seuil : bilan des lignes omises ou perdues depuis le dernier
+    uint32_t omises = _seriePerdues;
+    for (uint32_t o : _serieOmises) {
+      omises += o;
+    }
+    if (!_serieSaturee && omises != _serieSignalees) {
+      int n = snprintf(_serieLigne, sizeof(_serieLigne), "[LOGS] %lu ligne(s) non écrite(s) sur la sortie série.\r\n", (unsigned long)(omises - _serieSignalees));
+      _serieSignalees = omises;
+      _serieLongueur = n > 0 ? ((size_t)n < sizeof(_serieLigne) ? (size_t)n : sizeof(_serieLigne) - 1) : 0;
+      _seriePos = 0;
+      continue;
+    }
 
-  for (size_t i = 0; i < outCount / 2; ++i) {
-    Line tmp = out[i];
-    out[i] = out[outCount - 1 - i];
-    out[outCount - 1 - i] = tmp;
-  }
+    uint8_t entree[kMaxRecordLen];
+    uint32_t attente = 0;
+    if (!prochaineSerie(entree, attente)) {
+      _serieSaturee = false;
+      return;
+    }
 
-  return outCount;
+    Entete e;
+    memcpy(&e, entree, sizeof(e));
+    if (omettreSerie((NIVEAU)e.niveau, attente)) {
+      ++_serieOmises[e.niveau];
+      continue;
+    }
+
+    Line line;
+    mettreEnForme(entree, line);
+    line.format(_serieLigne, sizeof(_serieLigne) - 2);
+    _serieLongueur = strlen(_serieLigne);
+    _serieLigne[_serieLongueur++] = '\r';
+    _serieLigne[_serieLongueur++] = '\n';
+    _seriePos = 0;
+  }
 }
 
 void debug(const String& message) {
@@ -155,73 +590,36 @@ void warning(const String& message) {
 }
 
 void debug(const char* fmt, ...) {
-  char buffer[Logs::kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  logs.addLogv(Logs::DEBOGAGE, fmt, args);
   va_end(args);
-  logs.addLog("DEBUG", buffer);
-}
-
-static void formatHex(char* out, size_t outSize, const byte* payload, size_t length) {
-  if (!out || outSize == 0) {
-    return;
-  }
-  if (!payload || length == 0) {
-    out[0] = '\0';
-    return;
-  }
-  size_t pos = 0;
-  out[0] = '\0';
-  for (size_t i = 0; i < length && pos + 3 < outSize; ++i) {
-    int written = snprintf(out + pos, outSize - pos, "%s%02X", i > 0 ? " " : "", payload[i]);
-    if (written <= 0) {
-      break;
-    }
-    pos += static_cast<size_t>(written);
-  }
-}
-
-void logRadio(bool rx, const byte* payload, size_t length) {
-  char hex[Logs::kMaxMessageLen];
-  formatHex(hex, sizeof(hex), payload, length);
-  char buffer[Logs::kMaxMessageLen];
-  snprintf(buffer, sizeof(buffer), "[%s][%d] %s", rx ? "RX" : "TX", static_cast<int>(length), hex);
-  logs.addLog("RADIO", buffer);
 }
 
 void info(const char* fmt, ...) {
-  char buffer[Logs::kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  logs.addLogv(Logs::INFORMATION, fmt, args);
   va_end(args);
-  logs.addLog("INFO", buffer);
 }
 
 void error(const char* fmt, ...) {
-  char buffer[Logs::kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  logs.addLogv(Logs::ERREUR, fmt, args);
   va_end(args);
-  logs.addLog("ERROR", buffer);
 }
 
 void warning(const char* fmt, ...) {
-  char buffer[Logs::kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  logs.addLogv(Logs::AVERTISSEMENT, fmt, args);
   va_end(args);
-  logs.addLog("WARNING", buffer);
 }
 
 void warrning(const char* fmt, ...) {
-  char buffer[Logs::kMaxMessageLen];
   va_list args;
   va_start(args, fmt);
-  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  logs.addLogv(Logs::AVERTISSEMENT, fmt, args);
   va_end(args);
-  logs.addLog("WARNING", buffer);
 }
@@ -2,19 +2,42 @@
 
 #include <heltec.h>
 #include <TimeLib.h>
+#include <cstdarg>
+#include "RingArena.h"
 
+// Journal binaire à formatage différé : chaque entrée conserve le pointeur du format
+// (littéral) et ses arguments empaquetés dans une arène circulaire d'entrées de taille
+// variable. Le texte n'est produit que lorsque l'entrée est lue (Serial, /api/logs).
+// Les trames radio ont leur propre journal (RadioFrameLog).
 class Logs {
 public:
-  static constexpr size_t kMaxLines = 300;
+  static constexpr size_t kMaxLines = 300;          // Lignes rendues au plus par lecture
+  static constexpr size_t kArenaSize = 32768;       // ~1000 entrées usuelles
   static constexpr size_t kMaxLevelLen = 8;
   static constexpr size_t kMaxMessageLen = 192;
   static constexpr size_t kMaxFormattedLen = 256;
+  static constexpr size_t kMaxRecordLen = 240;      // En-tête et arguments d'une entrée
+  static constexpr size_t kMaxStringArg = 96;       // Argument %s copié au plus
+
+  // Sortie série vidée par une tâche de fond : les appelants n'attendent jamais l'UART
+  static constexpr uint8_t kSerialTaskCore = 1;
+  static constexpr UBaseType_t kSerialTaskPriority = 1;
+  static constexpr uint32_t kSerialTaskStackSize = 4096;
+  static constexpr uint32_t kSerialIdleMs = 5;
+  static constexpr uint32_t kMaxSerialBacklog = 64;   // Entrées en attente au-delà desquelles on échantillonne
+  static constexpr uint8_t kSerialInfoSampling = 4;   // Saturé : une ligne INFO sur 4
+
+  enum NIVEAU : uint8_t {
+    DEBOGAGE,
+    INFORMATION,
+    ERREUR,
+    AVERTISSEMENT,
+    AUTRE
+  };
 
-  explicit Logs(size_t maxLogSize = kMaxLines)
-      : _capacity(maxLogSize <= kMaxLines ? maxLogSize : kMaxLines) {}
-
+  // Entrée mise en forme pour la lecture
   struct Line {
-    Line() : time(0) {
+    Line() : time(0), seq(0) {
       level[0] = '\0';
       message[0] = '\0';
     }
@@ -26,51 +49,92 @@ public:
     char level[kMaxLevelLen];
     char message[kMaxMessageLen];
     time_t time;
+    uint32_t seq;
   };
 
   void clear();
 
-  // Ajouter un log avec un niveau
+  // Ajouter un log avec un niveau (message copié tel quel)
   void addLog(const char* level, const char* message);
   void addLog(const String& level, const String& message) {
     addLog(level.c_str(), message.c_str());
   }
 
-  // Ajouter un log formaté
+  // Ajouter un log formaté : fmt doit être un littéral, il est relu à la lecture
   void addLogf(const char* level, const char* fmt, ...);
+  void addLogv(NIVEAU niveau, const char* fmt, va_list args);
 
   size_t getLogCount(const char* level = nullptr);
 
-  size_t getLines(Line* out, size_t outCapacity, size_t limit = kMaxLines,
-                  const char* level = nullptr);
+  // Lecture séquentielle : première entrée de numéro >= seq (filtrée par niveau) ; seq est
+  // positionné sur l'entrée suivante, ou sur prochainSeq() s'il n'y en a plus : c'est le
+  // curseur de la lecture suivante
+  bool lire(uint32_t& seq, Line& out, const char* level = nullptr);
+
+  // Numéro de la première des `limit` dernières entrées du niveau
+  uint32_t chercherDebut(size_t limit, const char* level = nullptr);
+  uint32_t prochainSeq();
+
+  size_t entrees() const { return _arena.entrees(); }
+  size_t octetsUtilises() const { return _arena.octetsUtilises(); }
+
+  // Vidage série : lance la tâche de fond, ou vide ce que l'UART accepte sans attendre
+  bool startSerialTask();
+  void drainSerial();
+
+  uint32_t serialBacklog();
+  uint32_t serialDropped(NIVEAU niveau) const { return _serieOmises[niveau]; }
+  uint32_t serialLost() const { return _seriePerdues; }
+
+  static const char* nomNiveau(NIVEAU niveau);
+  static NIVEAU niveauDe(const char* level);
 
 private:
-  struct BusyGuard {
-    explicit BusyGuard(Logs& owner) : _owner(owner) {
-      while (_owner._busy) {
-        delay(1);
-      }
-      _owner._busy = true;
-    }
-    ~BusyGuard() { _owner._busy = false; }
+  enum GENRE : uint8_t {
+    FORMAT,     // Pointeur de format et arguments empaquetés
+    TEXTE       // Message copié
+  };
 
-    Logs& _owner;
+  struct Entete {
+    uint16_t taille;    // Entrée complète ; 0 : fin de l'arène, reprise au début
+    uint8_t niveau;
+    uint8_t genre;
+    uint32_t seq;
+    uint32_t time;
+    const char* fmt;
   };
 
   static void copyTruncate(char* dest, size_t destSize, const char* src);
-
-  size_t _capacity = 0;
-  size_t _count = 0;
-  size_t _head = 0;
-  Line _entries[kMaxLines];
-  volatile bool _busy = false;
+  static bool correspond(const Entete& entete, const char* level);
+  static void mettreEnForme(const uint8_t* entree, Line& out);
+  static void serialTaskMain(void* param);
+  bool prochaineSerie(uint8_t* entree, uint32_t& attente);
+  bool omettreSerie(NIVEAU niveau, uint32_t attente);
+
+  void inserer(uint8_t* entree, size_t taille);
+
+  // Écrite par la tâche radio, lue par le portail et la sortie série
+  typedef RingArena<Entete, kArenaSize> Arena;
+  Arena _arena;
+
+  // Sortie série : prochaine entrée à écrire et ligne en cours d'envoi
+  TaskHandle_t _serialTask = nullptr;
+  uint32_t _serieSeq = 1;
+  size_t _serieOffset = 0;
+  char _serieLigne[kMaxFormattedLen + 2];
+  size_t _serieLongueur = 0;
+  size_t _seriePos = 0;
+  bool _serieSaturee = false;
+  uint8_t _serieEchantillon = 0;
+  uint32_t _serieOmises[AUTRE + 1] = {0};
+  uint32_t _seriePerdues = 0;               // Entrées oubliées de l'arène avant d'être écrites
+  uint32_t _serieSignalees = 0;             // Omissions déjà annoncées sur la sortie série
 };
 
 extern Logs logs;
 
 void debug(const String& message);
 void debug(const char* fmt, ...);
-void logRadio(bool rx, const byte* payload, size_t length);
 void info(const String& message);
 void info(const char* fmt, ...);
 void error(const String& message);
@@ -6,6 +6,8 @@
 #include <map>
 #include <functional>
 #include "MqttDevice.h"
+#include "../MessageQueue.h"
+#include "../Logs.h"
 
 class MqttManager {
 public:
@@ -20,6 +22,19 @@ public:
     bool cleanSession = true;
   };
 
+  // Message échangé entre la tâche réseau et la tâche radio. Les charges utiles courtes
+  // sont copiées dans payload ; au-delà (diagnostics JSON, discovery), elles sont allouées
+  // sur le tas et libérées par la tâche qui reçoit le message.
+  struct Message {
+    char topic[128];
+    char payload[128];
+    char* grand;        // Charge utile hors message, nullptr si elle tient dans payload
+    bool retain;
+
+    const char* contenu() const { return grand ? grand : payload; }
+    void liberer() { free(grand); grand = nullptr; }
+  };
+
   explicit MqttManager(Client& net) : _client(net) {}
 
   void begin(const Options& o) {
@@ -31,14 +46,51 @@ public:
     _mqtt.setBufferSize(_bufferSize);
 
     _mqtt.setCallback([this](char* topic, uint8_t* payload, unsigned int len) {
+      if (_inbox.isReady()) {
+        // Commande remise à la tâche propriétaire des entités (tâche radio)
+        Message m;
+        if (!toMessage(topic, (const char*)payload, len, false, m)) {
+          ignorer(_inbox, topic, len);
+          return;
+        }
+        if (!_inbox.send(m)) m.liberer();
+        return;
+      }
       String t(topic), p; p.reserve(len);
       for (unsigned int i=0;i<len;i++) p += (char)payload[i];
-      auto it = _commandHandlers.find(t);
-      if (it != _commandHandlers.end()) it->second(p);
+      dispatchCommand(t, p);
     });
   }
 
-  bool loop() { if (!_mqtt.connected()) reconnect(); return _mqtt.loop(); }
+  // Active le découplage multi-tâches : la tâche appelante devient propriétaire du client MQTT,
+  // les publications des autres tâches passent par une file, les commandes reçues aussi.
+  bool enableQueues() {
+    _ownerTask = xTaskGetCurrentTaskHandle();
+    return _outbox.begin() && _inbox.begin();
+  }
+
+  // Exécute les commandes reçues : à appeler depuis la tâche qui possède les entités
+  void processCommands() {
+    Message m;
+    while (_inbox.receive(m)) {
+      dispatchCommand(String(m.topic), String(m.contenu()));
+      m.liberer();
+    }
+  }
+
+  // Messages perdus : file pleine, sujet trop long ou charge utile au-delà du tampon MQTT
+  uint32_t getDroppedPublications() const { return _outbox.getDropped(); }
+  uint32_t getDroppedCommands() const { return _inbox.getDropped(); }
+
+  bool loop() {
+    if (!_mqtt.connected()) reconnect();
+    Message m;
+    while (_outbox.receive(m)) {
+      _mqtt.publish(m.topic, (const uint8_t*)m.contenu(), strlen(m.contenu()), m.retain);
+      m.liberer();
+    }
+    return _mqtt.loop();
+  }
   bool connected() { return _mqtt.connected(); }
 
   // --- Device & Entity registration ---
@@ -96,7 +148,7 @@ public:
     if (!topic.full.length()) return false;
     char* buf = new char[_bufferSize];
     size_t n = serializeJson(doc, buf, _bufferSize);
-    bool ok = (n > 0) && _mqtt.publish(topic.full.c_str(), (uint8_t*)buf, n, topic.retain);
+    bool ok = (n > 0) && publishRaw(topic.full, String(buf), topic.qos, topic.retain);
     delete[] buf;
     return ok;
   }
@@ -132,6 +184,41 @@ private:
   std::map<String, MqttDevice*> _devices;
   std::map<String, CommandCallback> _commandHandlers;
 
+  TaskHandle_t _ownerTask = nullptr;
+  MessageQueue<Message> _outbox{24};
+  MessageQueue<Message> _inbox{8};
+  bool _ignoreSignale = false;
+
+  void dispatchCommand(const String& topic, const String& payload) {
+    auto it = _commandHandlers.find(topic);
+    if (it != _commandHandlers.end()) it->second(payload);
+  }
+
+  bool toMessage(const char* topic, const char* payload, size_t len, bool retain, Message& m) {
+    if (strlen(topic) >= sizeof(m.topic) || len >= _bufferSize) return false;
+    strcpy(m.topic, topic);
+    m.grand = nullptr;
+    char* dest = m.payload;
+    if (len >= sizeof(m.payload)) {
+      m.grand = (char*)malloc(len + 1);
+      if (!m.grand) return false;
+      dest = m.grand;
+    }
+    memcpy(dest, payload, len);
+    dest[len] = '\0';
+    m.retain = retain;
+    return true;
+  }
+
+  // Message impossible à transmettre : compté comme perdu, signalé une seule fois
+  void ignorer(MessageQueue<Message>& file, const char* topic, size_t len) {
+    file.compterPerdu();
+    if (!_ignoreSignale) {
+      _ignoreSignale = true;
+      error("[MQTT] Message ignoré (%s, %u octets) : sujet ou charge utile trop long.", topic, (uint32_t)len);
+    }
+  }
+
   bool isRegistered(MqttDevice* d) const {
     for (auto i : _devices) if (i.second == d) return true;
     return false;
@@ -159,6 +246,18 @@ private:
 
   bool publishRaw(const String& topic, const String& payload, uint8_t qos = 0, bool retain = true) {
     if (!topic.length()) return false;
+    if (_outbox.isReady() && xTaskGetCurrentTaskHandle() != _ownerTask) {
+      Message m;
+      if (!toMessage(topic.c_str(), payload.c_str(), payload.length(), retain, m)) {
+        ignorer(_outbox, topic.c_str(), payload.length());
+        return false;
+      }
+      if (!_outbox.send(m)) {
+        m.liberer();
+        return false;
+      }
+      return true;
+    }
     return _mqtt.publish(topic.c_str(), (uint8_t*)payload.c_str(), payload.length(), retain);
   }
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <heltec.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <type_traits>
+
+// File FreeRTOS bornée de messages typés, copiés par valeur entre tâches
+template <typename T>
+class MessageQueue {
+    static_assert(std::is_trivially_copyable<T>::value, "Les messages sont copiés octet par octet par FreeRTOS");
+
+    public:
+        explicit MessageQueue(size_t capacity) : _capacity(capacity) {}
+
+        bool begin() {
+            if (_queue == nullptr) {
+                _queue = xQueueCreate(_capacity, sizeof(T));
+            }
+            return _queue != nullptr;
+        }
+
+        bool isReady() const { return _queue != nullptr; }
+
+        bool send(const T& message, TickType_t wait = 0) {
+            if (_queue == nullptr || xQueueSend(_queue, &message, wait) != pdTRUE) {
+                ++_dropped;
+                return false;
+            }
+            return true;
+        }
+
+        bool receive(T& message, TickType_t wait = 0) {
+            return _queue != nullptr && xQueueReceive(_queue, &message, wait) == pdTRUE;
+        }
+
+        size_t size() const { return _queue != nullptr ? uxQueueMessagesWaiting(_queue) : 0; }
+        size_t capacity() const { return _capacity; }
+        uint32_t getDropped() const { return _dropped; }
+
+        // Message refusé avant l'envoi (trop long pour la file), compté avec les pertes
+        void compterPerdu() { ++_dropped; }
+
+    private:
+        size_t _capacity;
+        QueueHandle_t _queue = nullptr;
+        volatile uint32_t _dropped = 0;
+};
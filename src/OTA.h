@@ -1,21 +1,26 @@
 #pragma once
 
 #include <ArduinoOTA.h>
+#include <functional>
 #include "Logs.h"
 
 class OTA {
     public: 
-        void begin(const char* hostname) {
+        // onStart : appelé au début de la mise à jour, true pour le système de fichiers
+        void begin(const char* hostname, std::function<void(bool systemeFichiers)> onStart = nullptr) {
             ArduinoOTA.setHostname(hostname);
             ArduinoOTA.setTimeout(25000);
             ArduinoOTA
-                .onStart([]() {
+                .onStart([onStart]() {
                 info("Mise à jour via OTA...");
                 String type;
                 if (ArduinoOTA.getCommand() == U_FLASH)
                     type = "sketch";
                 else // U_SPIFFS
                     type = "filesystem";
+                if (onStart) {
+                    onStart(ArduinoOTA.getCommand() != U_FLASH);
+                }
             }).onEnd([](){ 
             }).onProgress([](unsigned int progress, unsigned int total){ 
             }).onError([](ota_error_t err) {
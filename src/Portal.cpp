@@ -10,7 +10,9 @@
 extern Logs logs;
 
 static constexpr size_t kMaxQueryLines = 120;
-static Logs::Line s_logLines[kMaxQueryLines];
+static constexpr size_t kDefaultQueryLines = 100;
+static constexpr size_t kMaxQueryFrames = 300;
+static constexpr size_t kMaxArchiveLines = 2000;
 static volatile bool s_logsBusy = false;
 static uint8_t s_memoryMessageId = 0x10;
 
@@ -38,6 +40,27 @@ static bool parseUint16Hex(const String& input, uint16_t& out) {
   return true;
 }
 
+// Critère numérique de filtre (décimal ou 0x..) : absent => -1
+static bool parseFilterArg(WebServer& srv, const char* name, int32_t max, int32_t& out) {
+  out = -1;
+  if (!srv.hasArg(name)) {
+    return true;
+  }
+  String s = srv.arg(name);
+  s.trim();
+  if (s.length() == 0) {
+    return true;
+  }
+
+  char* end = nullptr;
+  long value = strtol(s.c_str(), &end, 0);
+  if (!end || *end != '\0' || value < 0 || value > max) {
+    return false;
+  }
+  out = (int32_t)value;
+  return true;
+}
+
 static bool parseNetworkIdFromString(const String& s, NetworkID& out) {
   String hex = s;
   hex.trim();
@@ -143,8 +166,8 @@ static bool parseBoolArg(const String& s, bool defaultVal) {
   return defaultVal;
 }
 
-Portal::Portal(FrisquetManager& frisquetManager, uint16_t port)
-: _srv(port), _frisquetManager(frisquetManager) {}
+Portal::Portal(FrisquetManager& frisquetManager, LogArchive& archive, uint16_t port)
+: _srv(port), _frisquetManager(frisquetManager), _archive(archive) {}
 
 void Portal::begin(bool startApFallbackIfNoWifi) {
   if (startApFallbackIfNoWifi && !WiFi.isConnected()) {
@@ -158,9 +181,13 @@ void Portal::begin(bool startApFallbackIfNoWifi) {
   _srv.on("/api/reboot", HTTP_POST, [this]{ handleReboot(); });
   _srv.on("/api/logs", HTTP_GET, [this]{ handleGetLogs(); });
   _srv.on("/api/logs/clear", HTTP_POST, [this]{ handleClearLogs(); });
+  _srv.on("/api/logs/stream", HTTP_GET, [this]{ handleLogStream(); });
+  _srv.on("/api/logs/archive", HTTP_GET, [this]{ handleLogArchive(); });
   _srv.on("/logs", HTTP_GET, [this]{ handleLogsPage(); });
   _srv.on("/api/status", HTTP_GET, [this]{ handleStatus(); });
   _srv.on("/logs-radio", HTTP_GET, [this]{ handleRadioLogsPage(); });
+  _srv.on("/api/radio/frames", HTTP_GET, [this]{ handleRadioFrames(); });
+  _srv.on("/api/radio/frames/clear", HTTP_POST, [this]{ handleClearRadioFrames(); });
   _srv.on("/api/memory", HTTP_GET, [this]{ handleMemoryRead(); });
   _srv.on("/api/memory/scan", HTTP_GET, [this]{ handleMemoryScan(); });
   _srv.on("/memory", HTTP_GET, [this]{ handleMemoryPage(); });
@@ -171,7 +198,12 @@ void Portal::begin(bool startApFallbackIfNoWifi) {
   _srv.on("/api/satellite/z2/pair", HTTP_POST, [this]{ handlePairSatelliteZ2(); });
   _srv.on("/api/satellite/z3/pair", HTTP_POST, [this]{ handlePairSatelliteZ3(); });
   _srv.on("/api/network-id/recup", HTTP_POST, [this]{ handleRecupNetworkId(); });
+  _srv.on("/api/radio/calibrate", HTTP_POST, [this]{ handleCalibrateRadio(); });
+
 
+  // Reprise d'un flux de logs interrompu
+  static const char* kCollectedHeaders[] = { "Last-Event-ID" };
+  _srv.collectHeaders(kCollectedHeaders, 1);
 
   _srv.onNotFound([this](){
     _srv.send(404, "text/plain; charset=utf-8", "404 Non trouvé");
@@ -183,6 +215,7 @@ void Portal::begin(bool startApFallbackIfNoWifi) {
 
 void Portal::loop() {
   _srv.handleClient();
+  pushLogStreams();
 }
 
 void Portal::handleClearLogs() {
@@ -255,7 +288,12 @@ void Portal::handleGetConfig() {
   json += "\"useSatelliteVirtualZ2\":" +
           String(_frisquetManager.config().useSatelliteVirtualZ2() ? "true" : "false") + ",";
   json += "\"useSatelliteVirtualZ3\":" +
-          String(_frisquetManager.config().useSatelliteVirtualZ3() ? "true" : "false");
+          String(_frisquetManager.config().useSatelliteVirtualZ3() ? "true" : "false") + ",";
+
+  // Relevés Connect
+  json += "\"releveMinSec\":" + String(_frisquetManager.config().releveMinSec()) + ",";
+  json += "\"releveMaxSec\":" + String(_frisquetManager.config().releveMaxSec()) + ",";
+  json += "\"ackDeadlineMs\":" + String(_frisquetManager.config().ackDeadlineMs());
 
   json += "}";
   _srv.send(200, "application/json; charset=utf-8", json);
@@ -418,6 +456,28 @@ void Portal::handlePostConfig() {
     _frisquetManager.config().useSatelliteVirtualZ3(v);
   }
 
+  // Relevés Connect : 30 s à 1 heure
+  if (_srv.hasArg("releveMinSec") || _srv.hasArg("releveMaxSec")) {
+    long minimum = _srv.hasArg("releveMinSec") ? _srv.arg("releveMinSec").toInt() : _frisquetManager.config().releveMinSec();
+    long maximum = _srv.hasArg("releveMaxSec") ? _srv.arg("releveMaxSec").toInt() : _frisquetManager.config().releveMaxSec();
+    if (minimum < 30 || maximum > 3600 || minimum > maximum) {
+      _srv.send(400, "application/json; charset=utf-8", "{\"ok\":false,\"err\":\"Période de relevé invalide (30 à 3600 s, minimum inférieur au maximum)\"}");
+      return;
+    }
+    _frisquetManager.config().releveMinSec(minimum);
+    _frisquetManager.config().releveMaxSec(maximum);
+  }
+
+  // Délai maximal d'accusé : 20 à 1000 ms
+  if (_srv.hasArg("ackDeadlineMs")) {
+    long delai = _srv.arg("ackDeadlineMs").toInt();
+    if (delai < 20 || delai > 1000) {
+      _srv.send(400, "application/json; charset=utf-8", "{\"ok\":false,\"err\":\"Délai maximal d'accusé invalide (20 à 1000 ms)\"}");
+      return;
+    }
+    _frisquetManager.config().ackDeadlineMs(delai);
+  }
+
   _frisquetManager.config().save();
   info("[PORTAIL] Configuration enregistrée, redémarrage programmé");
 
@@ -442,7 +502,7 @@ void Portal::handleGetLogs() {
   } guard;
 
   // ?limit=100 (par défaut)
-  size_t limit = 100;
+  size_t limit = kDefaultQueryLines;
   if (_srv.hasArg("limit")) {
     int v = _srv.arg("limit").toInt();
     if (v > 0) {
@@ -459,8 +519,25 @@ void Portal::handleGetLogs() {
     level = _srv.arg("level");
   }
 
-  size_t outCount = logs.getLines(s_logLines, kMaxQueryLines, limit,
-                                  level.length() > 0 ? level.c_str() : nullptr);
+  // Entrées mises en forme une à une pendant l'envoi ; X-Logs-Next est le curseur de la
+  // requête suivante (?since=), qui ne renvoie alors que les nouvelles entrées
+  const char* filtre = level.length() > 0 ? level.c_str() : nullptr;
+  uint32_t fin = logs.prochainSeq();
+  uint32_t since = 0;
+  if (_srv.hasArg("since")) {
+    since = strtoul(_srv.arg("since").c_str(), nullptr, 10);
+  }
+  _srv.sendHeader("X-Logs-Next", String(fin));
+  if (since == fin) {
+    _srv.send(200, "application/json; charset=utf-8", "[]");
+    return;
+  }
+
+  // Curseur plus récent que le journal (redémarrage) : dernières entrées, le client repart de X-Logs-Next
+  uint32_t seq = logs.chercherDebut(limit, filtre);
+  if (since > seq && since < fin) {
+    seq = since;
+  }
 
   auto sendEscapedJson = [this](const char* text) {
     char buffer[128];
@@ -513,14 +590,15 @@ void Portal::handleGetLogs() {
   _srv.send(200, "application/json; charset=utf-8", "");
   _srv.sendContent("[");
   bool first = true;
-  for (size_t i = 0; i < outCount; ++i) {
+  Logs::Line line;
+  while (seq < fin && logs.lire(seq, line, filtre) && line.seq < fin) {
     if (!first) {
       _srv.sendContent(",");
     }
     first = false;
 
     char formatted[Logs::kMaxFormattedLen];
-    s_logLines[i].format(formatted, sizeof(formatted));
+    line.format(formatted, sizeof(formatted));
     _srv.sendContent("\"");
     sendEscapedJson(formatted);
     _srv.sendContent("\"");
@@ -528,6 +606,168 @@ void Portal::handleGetLogs() {
   _srv.sendContent("]");
 }
 
+void Portal::handleLogStream() {
+  LogStream* stream = nullptr;
+  for (LogStream& candidat : _logStreams) {
+    if (candidat.actif && !candidat.client.connected()) {
+      candidat.client.stop();
+      candidat.actif = false;
+    }
+    if (!candidat.actif && !stream) {
+      stream = &candidat;
+    }
+  }
+  if (!stream) {
+    _srv.send(503, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Too many streams\"}");
+    return;
+  }
+
+  stream->level = _srv.hasArg("level") ? _srv.arg("level") : String();
+  const char* filtre = stream->level.length() > 0 ? stream->level.c_str() : nullptr;
+
+  // Reconnexion automatique d'EventSource : reprise après le dernier id reçu
+  uint32_t fin = logs.prochainSeq();
+  uint32_t seq = 0;
+  if (_srv.header("Last-Event-ID").length() > 0) {
+    seq = strtoul(_srv.header("Last-Event-ID").c_str(), nullptr, 10) + 1;
+  } else if (_srv.hasArg("since")) {
+    seq = strtoul(_srv.arg("since").c_str(), nullptr, 10);
+  }
+  if (seq == 0 || seq > fin) {
+    seq = logs.chercherDebut(kDefaultQueryLines, filtre);
+  }
+
+  // Réponse écrite directement : la connexion reste ouverte et est alimentée par pushLogStreams()
+  stream->client = _srv.client();
+  stream->client.setNoDelay(true);
+  stream->client.print("HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/event-stream; charset=utf-8\r\n"
+                       "Cache-Control: no-cache\r\n"
+                       "Connection: keep-alive\r\n\r\n"
+                       "retry: 3000\n\n");
+  stream->seq = seq;
+  stream->lastWriteMs = millis();
+  stream->actif = true;
+}
+
+void Portal::pushLogStreams() {
+  uint32_t now = millis();
+  for (LogStream& stream : _logStreams) {
+    if (!stream.actif) {
+      continue;
+    }
+    if (!stream.client.connected()) {
+      stream.client.stop();
+      stream.actif = false;
+      continue;
+    }
+
+    // Rien de nouveau : lire() s'arrête sur le curseur sans parcourir le journal
+    const char* filtre = stream.level.length() > 0 ? stream.level.c_str() : nullptr;
+    Logs::Line line;
+    size_t envoyees = 0;
+    while (envoyees < kLogStreamBatch && logs.lire(stream.seq, line, filtre)) {
+      char formatted[Logs::kMaxFormattedLen];
+      line.format(formatted, sizeof(formatted));
+      for (char* p = formatted; *p; ++p) {
+        if (*p == '\r' || *p == '\n') {
+          *p = ' ';   // Un champ data SSE tient sur une ligne
+        }
+      }
+
+      char event[Logs::kMaxFormattedLen + 32];
+      int n = snprintf(event, sizeof(event), "id: %lu\ndata: %s\n\n", (unsigned long)line.seq, formatted);
+      size_t length = n < (int)sizeof(event) ? (size_t)n : sizeof(event) - 1;
+      if (stream.client.write((const uint8_t*)event, length) != length) {
+        stream.client.stop();
+        stream.actif = false;
+        break;
+      }
+      stream.lastWriteMs = now;
+      ++envoyees;
+    }
+
+    // Commentaire SSE périodique : garde la connexion ouverte et révèle les clients partis
+    if (stream.actif && now - stream.lastWriteMs >= kLogStreamKeepAliveMs) {
+      if (stream.client.print(": ping\n\n") == 0) {
+        stream.client.stop();
+        stream.actif = false;
+      }
+      stream.lastWriteMs = now;
+    }
+  }
+}
+
+void Portal::handleLogArchive() {
+  // ?from=<epoch>&to=<epoch> (secondes), ?kind=logs|frames, ?limit=2000
+  uint32_t debut = _srv.hasArg("from") ? strtoul(_srv.arg("from").c_str(), nullptr, 10) : 0;
+  uint32_t fin = _srv.hasArg("to") ? strtoul(_srv.arg("to").c_str(), nullptr, 10) : UINT32_MAX;
+  String kind = _srv.hasArg("kind") ? _srv.arg("kind") : String();
+  bool journal = kind.length() == 0 || kind == "logs";
+  bool trames = kind.length() == 0 || kind == "frames";
+  size_t limit = kMaxArchiveLines;
+  if (_srv.hasArg("limit")) {
+    int v = _srv.arg("limit").toInt();
+    if (v > 0 && (size_t)v < limit) {
+      limit = (size_t)v;
+    }
+  }
+
+  if (!_archive.store().estActif()) {
+    _srv.send(503, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Archive indisponible\"}");
+    return;
+  }
+
+  _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  _srv.send(200, "text/plain; charset=utf-8", "");
+
+  // Lignes regroupées par envois d'environ 1 Ko
+  String lot;
+  lot.reserve(1200);
+  size_t lignes = 0;
+  _archive.store().parcourir(debut, fin, [&](const LogStore::Enregistrement& e) {
+    char ligne[Logs::kMaxFormattedLen + 3 * RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    if (e.genre == LogStore::JOURNAL && journal) {
+      char message[Logs::kMaxMessageLen];
+      size_t n = e.length < sizeof(message) - 1 ? e.length : sizeof(message) - 1;
+      memcpy(message, e.donnees, n);
+      message[n] = '\0';
+      Logs::Line line;
+      line.set(Logs::nomNiveau((Logs::NIVEAU)e.attribut), message, e.time);
+      line.format(ligne, sizeof(ligne));
+    } else if (e.genre == LogStore::TRAME && trames && e.length >= 3) {
+      int16_t rssi;
+      memcpy(&rssi, e.donnees, sizeof(rssi));
+      Logs::Line line;
+      line.set("RADIO", "", e.time);
+      line.format(ligne, sizeof(ligne));
+      size_t pos = strlen(ligne);
+      pos += snprintf(ligne + pos, sizeof(ligne) - pos, "%s [%u] %s", e.attribut ? "RX" : "TX",
+                      (unsigned)(e.length - 3), RadioFrameLog::nomIssue((RadioFrameLog::ISSUE)e.donnees[2]));
+      if (rssi != INT16_MIN) {
+        pos += snprintf(ligne + pos, sizeof(ligne) - pos, " %d dBm", rssi / 10);
+      }
+      for (size_t i = 3; i < e.length && pos + 4 < sizeof(ligne); ++i) {
+        pos += snprintf(ligne + pos, sizeof(ligne) - pos, " %02X", e.donnees[i]);
+      }
+    } else {
+      return true;
+    }
+
+    lot += ligne;
+    lot += '\n';
+    if (lot.length() >= 1024) {
+      _srv.sendContent(lot);
+      lot = "";
+    }
+    return ++lignes < limit;
+  });
+  if (lot.length() > 0) {
+    _srv.sendContent(lot);
+  }
+}
 
 void Portal::handleLogsPage() {
   _srv.send(200, "text/html; charset=utf-8", logsHtml());
@@ -555,7 +795,266 @@ void Portal::handleStatus() {
   json += "\"uptimeSec\":"     + String(upMs / 1000) + ",";
   json += "\"resetReason\":\"" + jsonEscape(String(resetReason)) + "\",";
   json += "\"freeHeap\":"      + String(freeHeap) + ",";
-  json += "\"minFreeHeap\":"   + String(minFreeHeap);
+  json += "\"minFreeHeap\":"   + String(minFreeHeap) + ",";
+
+  json += "\"logs\":{";
+  json += "\"entries\":"      + String((uint32_t)logs.entrees()) + ",";
+  json += "\"usedBytes\":"    + String((uint32_t)logs.octetsUtilises()) + ",";
+  json += "\"arenaBytes\":"   + String((uint32_t)Logs::kArenaSize) + ",";
+  json += "\"serialBacklog\":" + String(logs.serialBacklog()) + ",";
+  json += "\"serialLost\":"   + String(logs.serialLost()) + ",";
+  json += "\"nextSeq\":"      + String(logs.prochainSeq()) + ",";
+  uint8_t streams = 0;
+  for (const LogStream& stream : _logStreams) {
+    streams += stream.actif ? 1 : 0;
+  }
+  json += "\"streams\":"      + String(streams) + ",";
+  json += "\"serialDropped\":{";
+  for (uint8_t n = Logs::DEBOGAGE; n <= Logs::AUTRE; ++n) {
+    if (n != Logs::DEBOGAGE) json += ",";
+    json += "\"" + String(Logs::nomNiveau((Logs::NIVEAU)n)) + "\":" + String(logs.serialDropped((Logs::NIVEAU)n));
+  }
+  json += "}},";
+
+  FrisquetRadio& radio = _frisquetManager.radio();
+  json += "\"radioRx\":{";
+  json += "\"irq\":"          + String(radio.getRxIrqCount()) + ",";
+  json += "\"queued\":"       + String(radio.rxQueue().getPushed()) + ",";
+  json += "\"overflows\":"    + String(radio.rxQueue().getOverflows()) + ",";
+  json += "\"lost\":"         + String(radio.getRxLostCount()) + ",";
+  json += "\"crcErrors\":"    + String(radio.getRxCrcErrorCount()) + ",";
+  json += "\"highWater\":"    + String((uint32_t)radio.rxQueue().getHighWater()) + ",";
+  json += "\"capacity\":"     + String((uint32_t)radio.rxQueue().capacity());
+  json += "},";
+
+  BoilerMemoryMap& memoire = radio.memoire();
+  json += "\"memoryCache\":{";
+  json += "\"entries\":"      + String((uint32_t)memoire.size()) + ",";
+  json += "\"hits\":"         + String(memoire.getHits()) + ",";
+  json += "\"misses\":"       + String(memoire.getMisses()) + ",";
+  json += "\"evictions\":"    + String(memoire.getEvictions());
+  json += "},";
+
+  FrisquetRouter& routeur = _frisquetManager.routeur();
+  json += "\"routes\":{";
+  json += "\"unrouted\":"     + String(routeur.getNonRoutees()) + ",";
+  json += "\"table\":[";
+  for (size_t i = 0; i < routeur.routes().size(); ++i) {
+    const FrisquetRouter::Route& route = routeur.routes()[i];
+    if (i) json += ",";
+    json += "{\"name\":\"" + jsonEscape(String(route.nom)) + "\",";
+    json += "\"hits\":"        + String(route.hits) + ",";
+    json += "\"drops\":"       + String(route.drops) + "}";
+  }
+  json += "]},";
+
+  const FrameDedup::Stats& doublons = radio.doublons().stats();
+  json += "\"dedup\":{";
+  json += "\"checked\":"      + String(doublons.verifiees) + ",";
+  json += "\"suppressed\":"   + String(doublons.doublons) + ",";
+  json += "\"acksResent\":"   + String(doublons.accusesRenvoyes);
+  json += "},";
+
+  const DeferredQueue::Stats& travaux = radio.travaux().stats();
+  json += "\"deferred\":{";
+  json += "\"queued\":"       + String(travaux.differes) + ",";
+  json += "\"inline\":"       + String(travaux.immediats) + ",";
+  json += "\"maxDepth\":"     + String(travaux.profondeurMax) + ",";
+  json += "\"maxDrainUs\":"   + String(travaux.vidageMaxUs);
+  json += "},";
+
+  LogStore& archive = _archive.store();
+  json += "\"archive\":{";
+  json += "\"active\":"       + String(archive.estActif() ? "true" : "false") + ",";
+  json += "\"storedBytes\":"  + String((uint32_t)archive.octetsStockes()) + ",";
+  json += "\"pendingBytes\":" + String((uint32_t)archive.enAttente()) + ",";
+  json += "\"records\":"      + String(archive.stats().enregistrements) + ",";
+  json += "\"writes\":"       + String(archive.stats().ecritures) + ",";
+  json += "\"bytesWritten\":" + String(archive.stats().octetsEcrits) + ",";
+  json += "\"rotations\":"    + String(archive.stats().rotations) + ",";
+  json += "\"errors\":"       + String(archive.stats().erreurs) + ",";
+  json += "\"rejected\":"     + String(archive.stats().rejetes) + ",";
+  json += "\"lost\":"         + String(_archive.perdues());
+  json += "},";
+
+  RadioFrameLog& trames = radio.trames();
+  json += "\"frames\":{";
+  json += "\"entries\":"      + String((uint32_t)trames.trames()) + ",";
+  json += "\"usedBytes\":"    + String((uint32_t)trames.octetsUtilises()) + ",";
+  json += "\"arenaBytes\":"   + String((uint32_t)RadioFrameLog::kArenaSize) + ",";
+  json += "\"nextSeq\":"      + String(trames.prochainSeq());
+  json += "},";
+
+  AckTurnaround& accuses = radio.accuses();
+  json += "\"ackTurnaround\":{";
+  json += "\"deadlineMs\":"   + String(accuses.delaiMaxUs() / 1000) + ",";
+  json += "\"lastUs\":"       + String(accuses.dernierUs()) + ",";
+  json += "\"overruns\":"     + String(accuses.depassements()) + ",";
+  json += "\"bucketMs\":"     + String(AckTurnaround::kClasseMs) + ",";
+  json += "\"types\":{";
+  for (uint8_t t = 0; t < AckTurnaround::NB_TYPES; ++t) {
+    const AckTurnaround::Mesures& mesures = accuses.mesures((AckTurnaround::TYPE)t);
+    if (t) json += ",";
+    json += "\"" + String(AckTurnaround::nomType((AckTurnaround::TYPE)t)) + "\":{";
+    json += "\"acks\":"       + String(mesures.accuses) + ",";
+    json += "\"overruns\":"   + String(mesures.depassements) + ",";
+    json += "\"meanUs\":"     + String(mesures.moyenneUs) + ",";
+    json += "\"maxUs\":"      + String(mesures.maxUs) + ",";
+    json += "\"histogram\":[";
+    for (size_t c = 0; c < AckTurnaround::kClasses; ++c) {
+      if (c) json += ",";
+      json += String(mesures.histogramme[c]);
+    }
+    json += "]}";
+  }
+  json += "}},";
+
+  DutyCycle& dutyCycle = radio.dutyCycle();
+  uint32_t airtimeUs = dutyCycle.utiliseUs();
+  json += "\"airtime\":{";
+  json += "\"usedMs\":"       + String(airtimeUs / 1000) + ",";
+  json += "\"budgetMs\":"     + String(DutyCycle::kBudgetUs / 1000) + ",";
+  json += "\"usedPct\":"      + String(airtimeUs * 100.0f / DutyCycle::kBudgetUs, 1) + ",";
+  json += "\"transmissions\":" + String(dutyCycle.stats().emissions) + ",";
+  json += "\"deferred\":"     + String(dutyCycle.stats().differees) + ",";
+  json += "\"shed\":"         + String(dutyCycle.stats().delestees);
+  json += "},";
+
+  RadioTransactionEngine& transactions = radio.transactions();
+  json += "\"transactions\":{";
+  json += "\"completed\":"    + String(transactions.getCompleted()) + ",";
+  json += "\"failed\":"       + String(transactions.getFailed()) + ",";
+  json += "\"retransmissions\":" + String(transactions.getRetransmissions()) + ",";
+  json += "\"channelBusy\":"  + String(transactions.getChannelBusy()) + ",";
+  json += "\"successAfter\":[";
+  for (uint8_t i = 1; i <= RadioTransactionEngine::kDefaultAttempts; ++i) {
+    if (i > 1) json += ",";
+    json += String(transactions.getSuccessAfter(i));
+  }
+  json += "]},";
+
+  TrafficLearner& trafic = radio.trafic();
+  uint32_t maintenant = millis();
+  uint32_t prochaine = trafic.prochaineEmission(maintenant);
+  json += "\"traffic\":{";
+  json += "\"quiet\":"        + String(trafic.estCalme(maintenant) ? "true" : "false") + ",";
+  json += "\"nextExpectedMs\":" + String(prochaine == UINT32_MAX ? -1 : (long)prochaine) + ",";
+  json += "\"devices\":[";
+  bool premier = true;
+  for (size_t i = 0; i < TrafficLearner::kMaxAppareils; ++i) {
+    const TrafficLearner::Appareil& appareil = trafic.appareils()[i];
+    if (!appareil.actif) continue;
+    if (!premier) json += ",";
+    premier = false;
+    json += "{\"id\":"         + String(appareil.id) + ",";
+    json += "\"to\":"          + String(appareil.idDestinataire) + ",";
+    json += "\"type\":"        + String(appareil.type) + ",";
+    json += "\"periodMs\":"    + String(appareil.periodeMs) + ",";
+    json += "\"confidence\":"  + String(appareil.confiance) + ",";
+    json += "\"lastSeenAgoMs\":" + String(maintenant - appareil.derniereEmission) + "}";
+  }
+  json += "]},";
+
+  ReplyInterceptor& interceptions = radio.interceptions();
+  json += "\"boilerTurnaround\":{";
+  json += "\"samples\":"      + String(interceptions.echantillons()) + ",";
+  json += "\"meanMs\":"       + String(interceptions.moyenneMs()) + ",";
+  json += "\"deviationMs\":"  + String(interceptions.ecartMs()) + ",";
+  json += "\"windowMs\":"     + String(interceptions.fenetreMs()) + ",";
+  json += "\"armed\":"        + String(interceptions.stats().armees) + ",";
+  json += "\"received\":"     + String(interceptions.stats().recues) + ",";
+  json += "\"refused\":"      + String(interceptions.stats().refusees) + ",";
+  json += "\"expired\":"      + String(interceptions.stats().expirees) + ",";
+  json += "\"saturated\":"    + String(interceptions.stats().saturees) + ",";
+  json += "\"bucketMs\":"     + String(ReplyInterceptor::kClasseMs) + ",";
+  json += "\"histogram\":[";
+  for (size_t i = 0; i < ReplyInterceptor::kClasses; ++i) {
+    if (i) json += ",";
+    json += String(interceptions.classe(i));
+  }
+  json += "]},";
+
+  json += "\"links\":[";
+  premier = true;
+  for (size_t i = 0; i < LinkStats::kMaxPairs; ++i) {
+    const LinkStats::Pair& lien = radio.liens().pairs()[i];
+    if (!lien.actif) continue;
+    if (!premier) json += ",";
+    premier = false;
+    json += "{\"id\":"          + String(lien.id) + ",";
+    json += "\"frames\":"       + String(lien.trames) + ",";
+    json += "\"lastSeenAgoMs\":" + String(maintenant - lien.derniereTrame) + ",";
+    json += "\"rssi\":"         + (isnan(lien.rssi) ? String("null") : String(lien.rssi, 1)) + ",";
+    json += "\"rssiMin\":"      + (isnan(lien.rssiMin) ? String("null") : String(lien.rssiMin, 0)) + ",";
+    json += "\"rssiMax\":"      + (isnan(lien.rssiMax) ? String("null") : String(lien.rssiMax, 0)) + ",";
+    json += "\"rssiHistogram\":[";
+    for (size_t c = 0; c < LinkStats::kRssiClasses; ++c) {
+      if (c) json += ",";
+      json += String(lien.histogrammeRssi[c]);
+    }
+    json += "],";
+    json += "\"success\":"      + String(lien.succes) + ",";
+    json += "\"timeouts\":"     + String(lien.expirations) + ",";
+    json += "\"refused\":"      + String(lien.refus) + ",";
+    json += "\"successAfter\":[";
+    for (size_t c = 0; c < LinkStats::kEmissionsMax; ++c) {
+      if (c) json += ",";
+      json += String(lien.succesApres[c]);
+    }
+    json += "],";
+    json += "\"rttMs\":"        + String(lien.latenceUs / 1000) + ",";
+    json += "\"rttHistogram\":[";
+    for (size_t c = 0; c < LinkStats::kLatenceClasses; ++c) {
+      if (c) json += ",";
+      json += String(lien.histogrammeLatence[c]);
+    }
+    json += "]}";
+  }
+  json += "],";
+
+  ReadPlanner& lectures = radio.lectures();
+  json += "\"reads\":{";
+  json += "\"blocks\":"       + String(lectures.getBlocs()) + ",";
+  json += "\"merged\":"       + String(lectures.getFusionnees()) + ",";
+  json += "\"needs\":[";
+  premier = true;
+  uint32_t now = millis();
+  for (const ReadPlanner::Besoin& besoin : lectures.besoins()) {
+    if (!premier) json += ",";
+    premier = false;
+    json += "{\"name\":\""     + String(besoin.nom) + "\",";
+    json += "\"address\":"      + String(besoin.adresse) + ",";
+    json += "\"size\":"         + String(besoin.taille) + ",";
+    json += "\"periodMs\":"     + String(besoin.periodeMs) + ",";
+    json += "\"periodMinMs\":"  + String(besoin.periodeMinMs) + ",";
+    json += "\"periodMaxMs\":"  + String(besoin.periodeMaxMs) + ",";
+    json += "\"isolated\":"     + String(besoin.estIsole(now) ? "true" : "false") + ",";
+    json += "\"mergeRetryMs\":" + String(besoin.repriseFusionMs(now)) + ",";
+    json += "\"read\":"         + String(besoin.lectures) + ",";
+    json += "\"cached\":"       + String(besoin.servies) + ",";
+    json += "\"failed\":"       + String(besoin.echecs) + "}";
+  }
+  json += "]},";
+
+  RadioCalibration& calibration = radio.calibration();
+  json += "\"calibration\":{";
+  json += "\"state\":\""     + jsonEscape(String(RadioCalibration::nomEtat(calibration.etat()))) + "\",";
+  json += "\"offsetKHz\":"    + String(calibration.decalageKHz(), 1) + ",";
+  json += "\"bandwidthKHz\":" + String(calibration.bandeKHz(), 1) + ",";
+  json += "\"step\":"         + String((uint32_t)calibration.palierCourant()) + ",";
+  json += "\"dwellSec\":"     + String(calibration.palierMs() / 1000) + ",";
+  json += "\"steps\":[";
+  if (calibration.etat() != RadioCalibration::ETAT::INACTIVE) {
+    for (size_t i = 0; i < RadioCalibration::kPaliers; ++i) {
+      const RadioCalibration::Palier& palier = calibration.palier(i);
+      if (i) json += ",";
+      json += "{\"offsetKHz\":"  + String(palier.decalageKHz, 0) + ",";
+      json += "\"bandwidthKHz\":" + String(palier.bandeKHz, 1) + ",";
+      json += "\"frames\":"       + String(palier.trames) + ",";
+      json += "\"rssi\":"         + (palier.trames ? String(palier.rssiMoyen(), 1) : String("null")) + "}";
+    }
+  }
+  json += "]}";
   json += "}";
   _srv.send(200, "application/json; charset=utf-8", json);
 }
@@ -601,14 +1100,12 @@ void Portal::handleSendRadio() {
   size_t payloadLength = 0;
   hexStringToBufferRaw(hex, payload, 100, payloadLength);
 
-  logRadio(false, payload, payloadLength);
-  //_frisquetManager.radio().interruptReceive = true;
-  _frisquetManager.radio().transmit(payload, payloadLength);
-  //_frisquetManager.radio().interruptReceive = false;
-
-  bool ok = true;
+  int16_t err = _frisquetManager.demanderEmission(payload, payloadLength);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
 
-  if (ok) {
+  if (err == RADIOLIB_ERR_NONE) {
     _srv.send(200, "application/json; charset=utf-8", "{\"ok\":true}");
   } else {
     _srv.send(500, "application/json; charset=utf-8",
@@ -616,6 +1113,93 @@ void Portal::handleSendRadio() {
   }
 }
 
+void Portal::handleRadioFrames() {
+  size_t limit = kDefaultQueryLines;
+  if (_srv.hasArg("limit")) {
+    int v = _srv.arg("limit").toInt();
+    if (v > 0) {
+      limit = (size_t)v;
+    }
+  }
+  if (limit > kMaxQueryFrames) {
+    limit = kMaxQueryFrames;
+  }
+
+  // ?device=0x08&type=0x03&address=0x79E0 : filtrés ici, sans mise en forme des trames écartées
+  int32_t appareil, type, adresse;
+  if (!parseFilterArg(_srv, "device", 0xFF, appareil) ||
+      !parseFilterArg(_srv, "type", 0xFF, type) ||
+      !parseFilterArg(_srv, "address", 0xFFFF, adresse)) {
+    _srv.send(400, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Filtre invalide\"}");
+    return;
+  }
+  RadioFrameLog::Filtre filtre;
+  filtre.appareil = appareil;
+  filtre.type = type;
+  filtre.adresse = adresse;
+
+  // Même curseur que /api/logs : X-Frames-Next, puis ?since=
+  RadioFrameLog& trames = _frisquetManager.radio().trames();
+  uint32_t fin = trames.prochainSeq();
+  uint32_t since = 0;
+  if (_srv.hasArg("since")) {
+    since = strtoul(_srv.arg("since").c_str(), nullptr, 10);
+  }
+  _srv.sendHeader("X-Frames-Next", String(fin));
+  if (since == fin) {
+    _srv.send(200, "application/json; charset=utf-8", "[]");
+    return;
+  }
+  uint32_t seq = trames.chercherDebut(limit, filtre);
+  if (since > seq && since < fin) {
+    seq = since;
+  }
+
+  _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  _srv.send(200, "application/json; charset=utf-8", "");
+  _srv.sendContent("[");
+  bool first = true;
+  RadioFrameLog::Trame trame;
+  char json[384 + RADIOLIB_SX126X_MAX_PACKET_LENGTH * 2];
+  while (seq < fin && trames.lire(seq, trame, filtre) && trame.seq < fin) {
+    // Hexadécimal et décodage produits ici seulement, à la demande du portail
+    int pos = snprintf(json, sizeof(json), "%s{\"seq\":%lu,\"time\":%lu,\"ms\":%lu,\"dir\":\"%s\",\"issue\":\"%s\",\"len\":%u",
+                       first ? "" : ",", (unsigned long)trame.seq, (unsigned long)trame.time, (unsigned long)trame.millis,
+                       trame.rx ? "RX" : "TX", RadioFrameLog::nomIssue(trame.issue), trame.length);
+    if (!isnan(trame.rssi)) {
+      pos += snprintf(json + pos, sizeof(json) - pos, ",\"rssi\":%.1f", trame.rssi);
+    }
+    if (trame.length >= sizeof(RadioTrameHeader)) {
+      const RadioTrameHeader* header = (const RadioTrameHeader*)trame.donnees;
+      pos += snprintf(json + pos, sizeof(json) - pos,
+                      ",\"from\":%u,\"to\":%u,\"assoc\":%u,\"msg\":%u,\"recv\":%u,\"type\":\"%s\",\"typeId\":%u,\"ack\":%s",
+                      header->idExpediteur, header->idDestinataire, header->idAssociation, header->idMessage,
+                      header->idReception & 0x7F, RadioFrameLog::nomType(header->type), header->type,
+                      (header->idReception & 0x80) ? "true" : "false");
+    }
+    if (trame.taille > 0) {
+      pos += snprintf(json + pos, sizeof(json) - pos, ",\"addr\":%u,\"words\":%u", trame.adresse, trame.taille);
+    }
+    if (trame.tailleEcriture > 0) {
+      pos += snprintf(json + pos, sizeof(json) - pos, ",\"writeAddr\":%u,\"writeWords\":%u", trame.adresseEcriture, trame.tailleEcriture);
+    }
+    pos += snprintf(json + pos, sizeof(json) - pos, ",\"hex\":\"");
+    for (size_t i = 0; i < trame.length && pos + 3 < (int)sizeof(json); ++i) {
+      pos += snprintf(json + pos, sizeof(json) - pos, "%02X", trame.donnees[i]);
+    }
+    snprintf(json + pos, sizeof(json) - pos, "\"}");
+    _srv.sendContent(json);
+    first = false;
+  }
+  _srv.sendContent("]");
+}
+
+void Portal::handleClearRadioFrames() {
+  _frisquetManager.radio().trames().vider();
+  _srv.send(200, "text/plain; charset=utf-8", "OK");
+}
+
 void Portal::handleRadioLogsPage() {
   _srv.send(200, "text/html; charset=utf-8", logsRadioHtml());
 }
@@ -653,6 +1237,11 @@ void Portal::handleMemoryRead() {
     len = static_cast<uint16_t>(0xFFFF - start + 1);
   }
 
+  MemoryReadStats stats;
+  if (!parseMaxAgeArg(stats)) {
+    return;
+  }
+
   uint16_t errorAddrs[256];
   int16_t errorCodes[256];
   size_t errorCount = 0;
@@ -681,6 +1270,14 @@ void Portal::handleMemoryRead() {
     _srv.sendContent(buf);
   };
 
+  uint8_t idExpediteur = 0x00;
+  uint8_t idAssociation = 0x00;
+  if (!memorySender(idExpediteur, idAssociation)) {
+    _srv.send(400, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Aucun module émetteur associé (Connect ou Satellite Z1)\"}");
+    return;
+  }
+
   _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
   _srv.send(200, "application/json; charset=utf-8", "");
   _srv.sendContent("{\"ok\":true,\"start\":");
@@ -691,71 +1288,27 @@ void Portal::handleMemoryRead() {
   sendUInt(len);
   _srv.sendContent(",\"words\":[");
 
-  for (uint16_t i = 0; i < len; ++i) {
-    uint16_t addr = static_cast<uint16_t>(start + i);
-    byte resp[32];
-    size_t respLen = sizeof(resp);
-
-   uint8_t idExpediteur = 0x00;
-   uint8_t idAssociation = 0x00;
-    if(_frisquetManager.config().useConnect() && _frisquetManager.connect().estAssocie()) {
-      idExpediteur = ID_CONNECT;
-      idAssociation = _frisquetManager.connect().getIdAssociation();
-    } else if(_frisquetManager.config().useSatelliteZ1() && _frisquetManager.satelliteZ1().estAssocie()) {
-      idExpediteur = ID_ZONE_1;
-      idAssociation = _frisquetManager.satelliteZ1().getIdAssociation();
-    }
-    if(idExpediteur == 0x00) {
-      _srv.send(400, "application/json; charset=utf-8",
-                "{\"ok\":false,\"err\":\"Aucun module émetteur associé (Connect ou Satellite Z1)\"}");
-      return;
-    }
-
-    int16_t err = _frisquetManager.radio().sendAsk(
-        idExpediteur,
-        ID_CHAUDIERE,
-        idAssociation,
-        ++s_memoryMessageId,
-        0x01,
-        addr,
-        0x0001,
-        resp,
-        respLen,
-      5);
-
-    int value = -1;
-    if (err == RADIOLIB_ERR_NONE) {
-      size_t headerSize = sizeof(FrisquetRadio::RadioTrameHeader);
-      if (respLen > headerSize) {
-        uint8_t dataLen = resp[headerSize];
-        if (dataLen >= 2 && respLen >= headerSize + 1 + dataLen) {
-          uint8_t b1 = resp[headerSize + 1];
-          uint8_t b2 = resp[headerSize + 2];
-          value = (static_cast<int>(b1) << 8) | static_cast<int>(b2);
-        } else if (respLen >= headerSize + 3) {
-          uint8_t b1 = resp[respLen - 2];
-          uint8_t b2 = resp[respLen - 1];
-          value = (static_cast<int>(b1) << 8) | static_cast<int>(b2);
-        }
+  bool first = true;
+  readMemoryRange(idExpediteur, idAssociation, start, len,
+    [&](uint16_t addr, int32_t value, int16_t err) {
+      if (!first) {
+        _srv.sendContent(",");
       }
-    }
-
-    if (i > 0) {
-      _srv.sendContent(",");
-    }
-    _srv.sendContent("\"");
-    if (value >= 0) {
-      sendHex4(static_cast<uint16_t>(value));
-    } else {
-      _srv.sendContent("??");
-      if (errorCount < 256) {
-        errorAddrs[errorCount] = addr;
-        errorCodes[errorCount] = err == RADIOLIB_ERR_NONE ? 1 : err;
-        ++errorCount;
+      first = false;
+      _srv.sendContent("\"");
+      if (value >= 0) {
+        sendHex4(static_cast<uint16_t>(value));
+      } else {
+        _srv.sendContent("??");
+        if (errorCount < 256) {
+          errorAddrs[errorCount] = addr;
+          errorCodes[errorCount] = err;
+          ++errorCount;
+        }
       }
-    }
-    _srv.sendContent("\"");
-  }
+      _srv.sendContent("\"");
+      return true;
+    }, stats);
 
   _srv.sendContent("],\"errors\":[");
   for (size_t i = 0; i < errorCount; ++i) {
@@ -768,7 +1321,15 @@ void Portal::handleMemoryRead() {
     sendInt(errorCodes[i]);
     _srv.sendContent("}");
   }
-  _srv.sendContent("]}");
+  _srv.sendContent("],\"requests\":");
+  sendUInt(stats.requests);
+  _srv.sendContent(",\"cacheHits\":");
+  sendUInt(stats.cacheHits);
+  _srv.sendContent(",\"elapsedMs\":");
+  sendUInt(stats.elapsedMs);
+  _srv.sendContent(",\"wordsPerSec\":");
+  _srv.sendContent(String(stats.wordsPerSecond(), 1));
+  _srv.sendContent("}");
 }
 
 void Portal::handleMemoryScan() {
@@ -823,63 +1384,53 @@ void Portal::handleMemoryScan() {
   int16_t lastErr = 0;
   uint16_t scanned = 0;
 
-   uint8_t idExpediteur = 0x00;
-   uint8_t idAssociation = 0x00;
-    if(_frisquetManager.config().useConnect() && _frisquetManager.connect().estAssocie()) {
-      idExpediteur = ID_CONNECT;
-      idAssociation = _frisquetManager.connect().getIdAssociation();
-    } else if(_frisquetManager.config().useSatelliteZ1() && _frisquetManager.satelliteZ1().estAssocie()) {
-      idExpediteur = ID_ZONE_1;
-      idAssociation = _frisquetManager.satelliteZ1().getIdAssociation();
-    }
-    if(idExpediteur == 0x00) {
-      _srv.send(400, "application/json; charset=utf-8",
-                "{\"ok\":false,\"err\":\"Aucun module émetteur associé (Connect ou Satellite Z1)\"}");
-      return;
-    }
-
-  for (uint16_t i = 0; i < maxScan; ++i) {
-    uint16_t addr = static_cast<uint16_t>(start + (i * step));
-    byte resp[32];
-    size_t respLen = sizeof(resp);
-
-    int16_t err = _frisquetManager.radio().sendAsk(
-        idExpediteur,
-        ID_CHAUDIERE,
-        idAssociation,
-        ++s_memoryMessageId,
-        0x01,
-        addr,
-        0x0001,
-        resp,
-        respLen,
-        5);
+  uint8_t idExpediteur = 0x00;
+  uint8_t idAssociation = 0x00;
+  if (!memorySender(idExpediteur, idAssociation)) {
+    _srv.send(400, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Aucun module émetteur associé (Connect ou Satellite Z1)\"}");
+    return;
+  }
 
+  auto onWord = [&](uint16_t addr, int32_t value, int16_t err) {
     ++scanned;
-    if (err != RADIOLIB_ERR_NONE) {
+    if (value < 0) {
       lastErr = err;
-      continue;
+      return true;
+    }
+    if (!found) {
+      foundAddr = addr;
+      foundValue = static_cast<uint16_t>(value);
+      found = true;
     }
+    return !stopOnValid;
+  };
 
-    if (respLen >= sizeof(FrisquetRadio::RadioTrameHeader)) {
-      FrisquetRadio::RadioTrameHeader header;
-      memcpy(&header, resp, sizeof(header));
-      if (header.type == FrisquetRadio::MessageType::READ) {
-        size_t headerSize = sizeof(FrisquetRadio::RadioTrameHeader);
-        if (respLen >= headerSize + 3) {
-          uint8_t b1 = resp[headerSize + 1];
-          uint8_t b2 = resp[headerSize + 2];
-          foundValue = (static_cast<uint16_t>(b1) << 8) | b2;
-        } else {
-          foundValue = 0;
-        }
-        foundAddr = addr;
-        found = true;
-        if (stopOnValid) {
-          break;
-        }
+  MemoryReadStats stats;
+  if (!parseMaxAgeArg(stats)) {
+    return;
+  }
+  if (step == 1) {
+    // Adresses contiguës : lecture par blocs
+    uint16_t count = maxScan;
+    if (start > 0xFFFF - (count - 1)) {
+      count = static_cast<uint16_t>(0xFFFF - start + 1);
+    }
+    readMemoryRange(idExpediteur, idAssociation, start, count, onWord, stats);
+  } else {
+    uint32_t debut = millis();
+    for (uint16_t i = 0; i < maxScan; ++i) {
+      uint16_t addr = static_cast<uint16_t>(start + (i * step));
+      uint16_t value = 0;
+      int16_t err = readMemoryBlock(idExpediteur, idAssociation, addr, 1, &value, stats);
+      if (err == RADIOLIB_ERR_NONE) {
+        ++stats.wordsRead;
+      }
+      if (!onWord(addr, err == RADIOLIB_ERR_NONE ? value : -1, err)) {
+        break;
       }
     }
+    stats.elapsedMs = millis() - debut;
   }
 
   String json = "{";
@@ -896,11 +1447,124 @@ void Portal::handleMemoryScan() {
     snprintf(buf, sizeof(buf), "%04X", foundValue);
     json += "\"value\":\"" + String(buf) + "\",";
   }
-  json += "\"lastErr\":" + String(lastErr);
+  json += "\"lastErr\":" + String(lastErr) + ",";
+  json += "\"requests\":" + String(stats.requests) + ",";
+  json += "\"cacheHits\":" + String(stats.cacheHits) + ",";
+  json += "\"elapsedMs\":" + String(stats.elapsedMs) + ",";
+  json += "\"wordsPerSec\":" + String(stats.wordsPerSecond(), 1);
   json += "}";
   _srv.send(200, "application/json; charset=utf-8", json);
 }
 
+bool Portal::memorySender(uint8_t& idExpediteur, uint8_t& idAssociation) {
+  idExpediteur = 0x00;
+  idAssociation = 0x00;
+  if(_frisquetManager.config().useConnect() && _frisquetManager.connect().estAssocie()) {
+    idExpediteur = ID_CONNECT;
+    idAssociation = _frisquetManager.connect().getIdAssociation();
+  } else if(_frisquetManager.config().useSatelliteZ1() && _frisquetManager.satelliteZ1().estAssocie()) {
+    idExpediteur = ID_ZONE_1;
+    idAssociation = _frisquetManager.satelliteZ1().getIdAssociation();
+  }
+  return idExpediteur != 0x00;
+}
+
+bool Portal::parseMaxAgeArg(MemoryReadStats& stats) {
+  if (!_srv.hasArg("maxAge")) {
+    return true;
+  }
+  char* end = nullptr;
+  unsigned long v = strtoul(_srv.arg("maxAge").c_str(), &end, 10);
+  if (!end || *end != '\0') {
+    _srv.send(400, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Paramètre maxAge invalide (ms)\"}");
+    return false;
+  }
+  stats.maxAgeMs = static_cast<uint32_t>(v);
+  return true;
+}
+
+int16_t Portal::readMemoryBlock(uint8_t idExpediteur, uint8_t idAssociation, uint16_t addr, uint16_t count, uint16_t* words,
+                                MemoryReadStats& stats) {
+  // Mots encore frais dans la copie locale (lectures, écoute passive, échos d'écriture)
+  byte cache[kMemoryMaxBlockWords * 2];
+  if (stats.maxAgeMs > 0 && count <= kMemoryMaxBlockWords &&
+      _frisquetManager.radio().memoire().lire(addr, count, cache, stats.maxAgeMs)) {
+    for (uint16_t i = 0; i < count; ++i) {
+      words[i] = (static_cast<uint16_t>(cache[i * 2]) << 8) | cache[i * 2 + 1];
+    }
+    ++stats.cacheHits;
+    return RADIOLIB_ERR_NONE;
+  }
+
+  // Moins de réémissions sur les blocs : un refus est repris en blocs plus petits
+  uint8_t retry = count > 1 ? 2 : 5;
+  ++stats.requests;
+  byte resp[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+  size_t respLen = sizeof(resp);
+  // Soumise sur la tâche radio, qui continue de servir la file RX et les accusés pendant l'attente
+  int16_t err = _frisquetManager.demanderLectureMemoire(idExpediteur, idAssociation, ++s_memoryMessageId, addr, count, retry,
+                                                        resp, respLen);
+  if (err != RADIOLIB_ERR_NONE) {
+    return err;
+  }
+
+  size_t headerSize = sizeof(FrisquetRadio::RadioTrameHeader);
+  if (respLen <= headerSize) {
+    return kErrMemoryReply;
+  }
+  uint8_t dataLen = resp[headerSize];
+  if (dataLen < count * 2 || respLen < headerSize + 1 + count * 2) {
+    return kErrMemoryReply;
+  }
+  for (uint16_t i = 0; i < count; ++i) {
+    words[i] = (static_cast<uint16_t>(resp[headerSize + 1 + i * 2]) << 8) | resp[headerSize + 2 + i * 2];
+  }
+  return RADIOLIB_ERR_NONE;
+}
+
+void Portal::readMemoryRange(uint8_t idExpediteur, uint8_t idAssociation, uint16_t start, uint16_t count,
+                             const MemoryWordCallback& onWord, MemoryReadStats& stats) {
+  uint32_t debut = millis();
+  uint16_t bloc = count < kMemoryMaxBlockWords ? count : kMemoryMaxBlockWords;
+  uint16_t offset = 0;
+  uint16_t words[kMemoryMaxBlockWords];
+
+  while (offset < count) {
+    uint16_t addr = static_cast<uint16_t>(start + offset);
+    uint16_t taille = count - offset < bloc ? count - offset : bloc;
+
+    int16_t err = readMemoryBlock(idExpediteur, idAssociation, addr, taille, words, stats);
+
+    if (err == RADIOLIB_ERR_NONE) {
+      stats.wordsRead += taille;
+      offset += taille;
+      for (uint16_t i = 0; i < taille; ++i) {
+        if (!onWord(static_cast<uint16_t>(addr + i), words[i], RADIOLIB_ERR_NONE)) {
+          stats.elapsedMs = millis() - debut;
+          return;
+        }
+      }
+      // Bloc accepté : on tente à nouveau des blocs plus grands
+      bloc = bloc * 2 < kMemoryMaxBlockWords ? bloc * 2 : kMemoryMaxBlockWords;
+    } else if (err == DutyCycle::kErrBudget) {
+      // Budget d'émission réservé au debug épuisé : inutile d'insister
+      onWord(addr, -1, err);
+      break;
+    } else if (taille > 1) {
+      // Bloc refusé (zone non lisible d'un seul tenant, trame perdue...) : moitié plus petit
+      bloc = taille / 2;
+    } else {
+      ++offset;
+      if (!onWord(addr, -1, err)) {
+        break;
+      }
+    }
+  }
+
+  stats.elapsedMs = millis() - debut;
+}
+
 void Portal::handleMemoryPage() {
   _srv.send(200, "text/html; charset=utf-8", memoryHtml());
 }
@@ -925,19 +1589,14 @@ void Portal::handlePairConnect() {
 
   info("[PORTAIL] Demande d'association du module Connect");
 
-  bool ok = false;
-  // Exemple : si tu as une méthode dédiée
-  
-  NetworkID networkId;
-  uint8_t idAssociation;
-  if(_frisquetManager.connect().associer(networkId, idAssociation)) {
-      _frisquetManager.connect().setIdAssociation(idAssociation);
-      _frisquetManager.radio().setNetworkID(networkId);
-      _frisquetManager.config().setNetworkID(networkId);
-      _frisquetManager.config().save();
-      _frisquetManager.connect().saveConfig();
-      info("[PORTAIL] Association réussie.");
-      ok = true;
+  // Écoute de la trame d'association sur la tâche radio ; configuration enregistrée par le gestionnaire
+  int16_t err = _frisquetManager.demanderAssociation(FrisquetManager::APPAREIL::CONNECT);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+  bool ok = err == RADIOLIB_ERR_NONE;
+  if (ok) {
+    info("[PORTAIL] Association réussie.");
   } else {
     error("[PORTAIL] Échec de l'association.");
   }
@@ -966,18 +1625,13 @@ void Portal::handlePairSondeExt() {
 
   info("[PORTAIL] Demande d'association de la sonde extérieure");
 
-  bool ok = false;
-  
-  NetworkID networkId;
-  uint8_t idAssociation;
-  if(_frisquetManager.sondeExterieure().associer(networkId, idAssociation)) {
-      _frisquetManager.sondeExterieure().setIdAssociation(idAssociation);
-      _frisquetManager.radio().setNetworkID(networkId);
-      _frisquetManager.config().setNetworkID(networkId);
-      _frisquetManager.config().save();
-      _frisquetManager.sondeExterieure().saveConfig();
-      info("[PORTAIL] Association réussie.");
-      ok = true;
+  int16_t err = _frisquetManager.demanderAssociation(FrisquetManager::APPAREIL::SONDE_EXTERIEURE);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+  bool ok = err == RADIOLIB_ERR_NONE;
+  if (ok) {
+    info("[PORTAIL] Association réussie.");
   } else {
     error("[PORTAIL] Échec de l'association.");
   }
@@ -1006,20 +1660,13 @@ void Portal::handlePairSatelliteZ1() {
 
   info("[PORTAIL] Demande d'association du Satellite Z1");
 
-  bool ok = false;
-  NetworkID networkId;
-  uint8_t idAssociation;
-
-  // ⚠️ À ADAPTER selon ton API réelle :
-  //   satelliteZ1(), setIdAssociation(), saveConfig()...
-  if (_frisquetManager.satelliteZ1().associer(networkId, idAssociation)) {
-    _frisquetManager.satelliteZ1().setIdAssociation(idAssociation);
-    _frisquetManager.radio().setNetworkID(networkId);
-    _frisquetManager.config().setNetworkID(networkId);
-    _frisquetManager.config().save();
-    _frisquetManager.satelliteZ1().saveConfig();
+  int16_t err = _frisquetManager.demanderAssociation(FrisquetManager::APPAREIL::SATELLITE_Z1);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+  bool ok = err == RADIOLIB_ERR_NONE;
+  if (ok) {
     info("[PORTAIL] Association Satellite Z1 réussie.");
-    ok = true;
   } else {
     error("[PORTAIL] Échec de l'association Satellite Z1.");
   }
@@ -1048,19 +1695,13 @@ void Portal::handlePairSatelliteZ2() {
 
   info("[PORTAIL] Demande d'association du Satellite Z2");
 
-  bool ok = false;
-  NetworkID networkId;
-  uint8_t idAssociation;
-
-  // ⚠️ À ADAPTER selon ton API réelle :
-  if (_frisquetManager.satelliteZ2().associer(networkId, idAssociation)) {
-    _frisquetManager.satelliteZ2().setIdAssociation(idAssociation);
-    _frisquetManager.radio().setNetworkID(networkId);
-    _frisquetManager.config().setNetworkID(networkId);
-    _frisquetManager.config().save();
-    _frisquetManager.satelliteZ2().saveConfig();
+  int16_t err = _frisquetManager.demanderAssociation(FrisquetManager::APPAREIL::SATELLITE_Z2);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+  bool ok = err == RADIOLIB_ERR_NONE;
+  if (ok) {
     info("[PORTAIL] Association Satellite Z2 réussie.");
-    ok = true;
   } else {
     error("[PORTAIL] Échec de l'association Satellite Z2.");
   }
@@ -1089,19 +1730,13 @@ void Portal::handlePairSatelliteZ3() {
 
   info("[PORTAIL] Demande d'association du Satellite Z3");
 
-  bool ok = false;
-  NetworkID networkId;
-  uint8_t idAssociation;
-
-  // ⚠️ À ADAPTER selon ton API réelle :
-  if (_frisquetManager.satelliteZ3().associer(networkId, idAssociation)) {
-    _frisquetManager.satelliteZ3().setIdAssociation(idAssociation);
-    _frisquetManager.radio().setNetworkID(networkId);
-    _frisquetManager.config().setNetworkID(networkId);
-    _frisquetManager.config().save();
-    _frisquetManager.satelliteZ3().saveConfig();
+  int16_t err = _frisquetManager.demanderAssociation(FrisquetManager::APPAREIL::SATELLITE_Z3);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+  bool ok = err == RADIOLIB_ERR_NONE;
+  if (ok) {
     info("[PORTAIL] Association Satellite Z3 réussie.");
-    ok = true;
   } else {
     error("[PORTAIL] Échec de l'association Satellite Z3.");
   }
@@ -1124,7 +1759,12 @@ void Portal::handleRecupNetworkId() {
 
   info("[PORTAIL] Demande de récupération du NetworkID");
 
-  if (_frisquetManager.recupererNetworkID()) {
+  int16_t err = _frisquetManager.demanderRecuperationNetworkID();
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+
+  if (err == RADIOLIB_ERR_NONE) {
     const NetworkID& nid = _frisquetManager.config().getNetworkID();
     String json = "{";
     json += "\"ok\":true,";
@@ -1138,10 +1778,67 @@ void Portal::handleRecupNetworkId() {
   }
 }
 
+void Portal::handleCalibrateRadio() {
+  if (_srv.method() != HTTP_POST) {
+    _srv.send(405, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Méthode non autorisée\"}");
+    return;
+  }
+
+  if (parseBoolArg(_srv.arg("cancel"), false)) {
+    if (sendRadioUnavailable(_frisquetManager.demanderAnnulationCalibration())) {
+      return;
+    }
+    _srv.send(200, "application/json; charset=utf-8", "{\"ok\":true,\"msg\":\"Calibration annulée\"}");
+    return;
+  }
+
+  uint32_t palierMs = RadioCalibration::kPalierDefautMs;
+  if (_srv.hasArg("dwellSec")) {
+    palierMs = (uint32_t)_srv.arg("dwellSec").toInt() * 1000;
+  }
+
+  info("[PORTAIL] Demande de calibration radio");
+
+  int16_t err = _frisquetManager.demanderCalibration(palierMs);
+  if (sendRadioUnavailable(err)) {
+    return;
+  }
+
+  if (err == RADIOLIB_ERR_NONE) {
+    RadioCalibration& calibration = _frisquetManager.radio().calibration();
+    String json = "{";
+    json += "\"ok\":true,";
+    json += "\"steps\":"      + String((uint32_t)RadioCalibration::kPaliers) + ",";
+    json += "\"dwellSec\":"   + String(calibration.palierMs() / 1000) + ",";
+    json += "\"msg\":\"Calibration démarrée\"";
+    json += "}";
+    _srv.send(200, "application/json; charset=utf-8", json);
+  } else {
+    _srv.send(409, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Calibration déjà en cours\"}");
+  }
+}
+
 
 // -------------------- Utils --------------------
 
+bool Portal::sendRadioUnavailable(int16_t err) {
+  if (err == FrisquetManager::kErrTacheIndisponible) {
+    _srv.send(503, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Tâche radio occupée, réessayer\"}");
+    return true;
+  }
+  if (err == FrisquetManager::kErrDelaiDepasse) {
+    _srv.send(504, "application/json; charset=utf-8",
+              "{\"ok\":false,\"err\":\"Pas de réponse de la tâche radio\"}");
+    return true;
+  }
+  return false;
+}
+
 void Portal::scheduleReboot(uint32_t delayMs) {
+  _archive.flush();   // Dernières lignes conservées malgré le redémarrage
   xTaskCreatePinnedToCore([](void* d){
     uint32_t ms = (uint32_t)d;
     vTaskDelay(ms / portTICK_PERIOD_MS);
@@ -1343,6 +2040,20 @@ String Portal::html() {
             </div>
           </div>
 
+          <div class='row' style='margin-bottom:10px'>
+            <label>Calibration radio</label>
+            <div class='row-inline'>
+              <input id='calibDwell' type='number' min='10' value='120'>
+              <button type='button' class='btn btn-sm' id='btnCalibRadio'>
+                Calibrer
+              </button>
+            </div>
+            <div class='hint'>
+              Durée d'écoute par réglage (s). Balayage de l'écart de fréquence et de la bande passante
+              sur le trafic de la chaudière ; résultat dans <code>/api/status</code>.
+            </div>
+          </div>
+
           <div class='grid-2'>
             <div class='row'>
               <label class='check-row'>
@@ -1367,6 +2078,25 @@ String Portal::html() {
               </label>
             </div>
           </div>
+          <div class='grid-2' style='margin-top:8px'>
+            <div class='row'>
+              <label>Relevé minimum (s)</label>
+              <input id='releveMinSec' type='number' min='30' max='3600' placeholder='60'>
+              <div class='hint'>Période de relevé des températures quand elles bougent.</div>
+            </div>
+            <div class='row'>
+              <label>Relevé maximum (s)</label>
+              <input id='releveMaxSec' type='number' min='30' max='3600' placeholder='900'>
+              <div class='hint'>Période de relevé quand les valeurs sont stables.</div>
+            </div>
+          </div>
+          <div class='grid-2' style='margin-top:8px'>
+            <div class='row'>
+              <label>Délai maximal d'accusé (ms)</label>
+              <input id='ackDeadlineMs' type='number' min='20' max='1000' placeholder='100'>
+              <div class='hint'>Au-delà, l'accusé est compté hors délai (diagnostic MQTT).</div>
+            </div>
+          </div>
 
           <div class='grid-3' style="margin-top:10px">
             <div class='row'>
@@ -1555,7 +2285,8 @@ const FIELDS = [
   "networkID","useConnect","useConnectPassive","useSondeExt","useDS18B20",
   "useZone1","useZone2","useZone3",
   "useSatelliteZ1","useSatelliteZ2","useSatelliteZ3",
-  "useSatelliteVirtualZ1","useSatelliteVirtualZ2","useSatelliteVirtualZ3"
+  "useSatelliteVirtualZ1","useSatelliteVirtualZ2","useSatelliteVirtualZ3",
+  "releveMinSec","releveMaxSec","ackDeadlineMs"
 ];
 
 function updatePairButtons() {
@@ -1813,6 +2544,21 @@ async function recupNetworkId() {
   }
 }
 
+async function calibrerRadio() {
+  try {
+    const dwell = ($("#calibDwell") || {}).value || "120";
+    const r = await fetch("/api/radio/calibrate?dwellSec=" + encodeURIComponent(dwell), { method:"POST" });
+    const j = await r.json();
+    if (j.ok) {
+      msg("Calibration démarrée : " + j.steps + " réglages de " + j.dwellSec + " s.");
+    } else {
+      msg("Erreur calibration : " + (j.err || "inconnue"));
+    }
+  } catch (e) {
+    msg("Erreur réseau lors de la calibration radio.");
+  }
+}
+
 document.addEventListener("DOMContentLoaded", ()=>{
   // Toggle password
   document.querySelectorAll('[data-toggle]').forEach(btn=>{
@@ -1869,6 +2615,8 @@ document.addEventListener("DOMContentLoaded", ()=>{
   if (btnPairSatZ2)   btnPairSatZ2.addEventListener("click", ()=>pairSatellite("2"));
   if (btnPairSatZ3)   btnPairSatZ3.addEventListener("click", ()=>pairSatellite("3"));
   if (btnRecupNetworkId) btnRecupNetworkId.addEventListener("click", recupNetworkId);
+  const btnCalibRadio = $("#btnCalibRadio");
+  if (btnCalibRadio) btnCalibRadio.addEventListener("click", calibrerRadio);
 
   // Attach change listener for the wifi static checkbox to update static inputs
   const chkStatic = $("#wifiStatic");
@@ -1975,6 +2723,7 @@ String Portal::logsHtml() {
       <label>Rafraîchissement
         <select id='refresh'>
           <option value='0'>Off</option>
+          <option value='live'>Direct</option>
           <option value='1000'>1s</option>
           <option value='2000' selected>2s</option>
           <option value='5000'>5s</option>
@@ -2011,6 +2760,7 @@ String Portal::logsHtml() {
 
       <button id='btnReload' class='btn'>Recharger</button>
       <button id='btnClear' class='btn'>Effacer</button>
+      <a class='btn' href='/api/logs/archive?kind=logs' target='_blank'>Archive flash</a>
     </div>
 
     <pre id='log'>(chargement...)</pre>
@@ -2018,16 +2768,21 @@ String Portal::logsHtml() {
 
   <div class='muted' style='text-align:center'>
     Astuce : filtre par niveau (p. ex. <code>ERROR</code>) et limite pour ne voir que la fin du journal.
+    Seules les nouvelles lignes sont transférées à chaque rafraîchissement ; « Direct » les reçoit au fil de l'eau.
   </div>
 
 </div>
 
 <script>
 const $ = s => document.querySelector(s);
-let raw = "";
+const kMaxClientLines = 2000;
+let lines = [];
+let cursor = 0;          // Numéro de la prochaine entrée attendue (X-Logs-Next / id SSE)
 let timer = null;
+let source = null;
 let pollInFlight = false;
 let pollStopped = false;
+let renderPending = false;
 
 const elLog     = $("#log");
 const selRef    = $("#refresh");
@@ -2038,51 +2793,69 @@ const cbAuto    = $("#autoscroll");
 const btnReload = $("#btnReload");
 const btnClear  = $("#btnClear");
 
-function applyFilters(txt){
-  if(!txt) return "";
-  let lines = txt.split("\n");
+function applyFilters(){
+  let out = lines;
 
   const lvl = selLvl.value.trim();
   const f   = inpFilter.value.trim().toLowerCase();
 
   if(lvl){
-    lines = lines.filter(l => l.includes(lvl));
+    out = out.filter(l => l.includes(lvl));
   }
   if(f){
-    lines = lines.filter(l => l.toLowerCase().includes(f));
+    out = out.filter(l => l.toLowerCase().includes(f));
   }
 
   const lim = parseInt(selLimit.value||"0",10);
-  if(lim>0 && lines.length>lim){
-    lines = lines.slice(-lim);
+  if(lim>0 && out.length>lim){
+    out = out.slice(-lim);
   }
 
-  return lines.join("\n");
+  return out.join("\n");
 }
 
 function render(){
-  const out = applyFilters(raw);
+  renderPending = false;
+  const out = applyFilters();
   elLog.textContent = out || "(vide)";
   if(cbAuto.checked){
     elLog.scrollTop = elLog.scrollHeight;
   }
 }
 
+function scheduleRender(){
+  if(renderPending) return;
+  renderPending = true;
+  requestAnimationFrame(render);
+}
+
+function append(arr){
+  if(!arr.length) return;
+  lines.push(...arr);
+  if(lines.length > kMaxClientLines){
+    lines.splice(0, lines.length - kMaxClientLines);
+  }
+  scheduleRender();
+}
+
+function levelParam(){
+  const lvl = selLvl.value.trim();
+  return lvl ? "&level="+encodeURIComponent(lvl) : "";
+}
+
+// Rechargement complet : dernières lignes du journal
 async function reload(){
-  if(pollInFlight || pollStopped) return;
+  if(pollInFlight) return;
   pollInFlight = true;
   try{
-    // On envoie la limite et éventuellement le niveau au backend
     const limitParam = selLimit.value === "0" ? "500" : selLimit.value;
-    const lvl = selLvl.value.trim();
-    const qs =
-      "?limit=" + encodeURIComponent(limitParam) +
-      (lvl ? "&level="+encodeURIComponent(lvl) : "") +
-      "&_=" + Date.now();
+    const qs = "?limit=" + encodeURIComponent(limitParam) + levelParam() + "&_=" + Date.now();
 
     const r = await fetch("/api/logs"+qs,{cache:"no-store"});
     const arr = await r.json();   // ["ligne1", "ligne2", ...]
-    raw = arr.join("\n");
+    cursor = parseInt(r.headers.get("X-Logs-Next")||"0",10);
+    lines = [];
+    append(arr);
     render();
   }catch(e){
     elLog.textContent = "Erreur chargement logs: " + e;
@@ -2091,9 +2864,47 @@ async function reload(){
   }
 }
 
+// Rafraîchissement : uniquement les entrées postérieures au curseur
+async function poll(){
+  if(pollInFlight || pollStopped) return;
+  pollInFlight = true;
+  try{
+    const r = await fetch("/api/logs?since=" + cursor + levelParam() + "&_=" + Date.now(),{cache:"no-store"});
+    const arr = await r.json();
+    const next = parseInt(r.headers.get("X-Logs-Next")||"0",10);
+    if(next < cursor){
+      lines = [];   // Appareil redémarré : numérotation repartie de 1
+      scheduleRender();
+    }
+    cursor = next;
+    append(arr);
+  }catch(e){
+    console.error("Erreur rafraîchissement logs", e);
+  } finally {
+    pollInFlight = false;
+  }
+}
+
+function startLive(){
+  source = new EventSource("/api/logs/stream?since=" + cursor + levelParam());
+  source.onmessage = e => {
+    cursor = parseInt(e.lastEventId||"0",10) + 1;
+    append([e.data]);
+  };
+  source.onerror = () => {
+    // Flux refusé (abonnés trop nombreux) : retour au rafraîchissement périodique
+    if(source && source.readyState === EventSource.CLOSED){
+      source = null;
+      selRef.value = "2000";
+      updateRefreshTimer();
+    }
+  };
+}
+
 function stopPolling(){
   pollStopped = true;
   if(timer){ clearTimeout(timer); timer = null; }
+  if(source){ source.close(); source = null; }
 }
 
 function startPolling(){
@@ -2107,7 +2918,7 @@ function scheduleNextPoll(){
   if(v>0){
     if(timer){ clearTimeout(timer); timer = null; }
     timer = setTimeout(async ()=>{
-      await reload();
+      await poll();
       scheduleNextPoll();
     }, v);
   }
@@ -2115,6 +2926,10 @@ function scheduleNextPoll(){
 
 function updateRefreshTimer(){
   stopPolling();
+  if(selRef.value === "live"){
+    startLive();
+    return;
+  }
   const v = parseInt(selRef.value||"0",10);
   if(v>0){
     startPolling();
@@ -2122,21 +2937,24 @@ function updateRefreshTimer(){
 }
 
 document.addEventListener("DOMContentLoaded", ()=>{
-  btnReload.addEventListener("click", reload);
+  btnReload.addEventListener("click", ()=>reload().then(updateRefreshTimer));
   btnClear.addEventListener("click", async ()=>{
     try{
       await fetch("/api/logs/clear",{method:"POST"});
-      raw = "";
+      lines = [];
       render();
     }catch(e){
       console.error("Erreur clear logs", e);
     }
   });
 
-  [selLvl, inpFilter, selLimit].forEach(el=>{
+  [inpFilter, selLimit].forEach(el=>{
     el.addEventListener("input", render);
   });
 
+  // Le niveau est filtré par l'appareil : le curseur change de sens, on recharge
+  selLvl.addEventListener("change", ()=>reload().then(updateRefreshTimer));
+
   selRef.addEventListener("change", updateRefreshTimer);
 
   reload().then(updateRefreshTimer);
@@ -2240,6 +3058,10 @@ String Portal::memoryHtml() {
         <input id='auto' type='checkbox'>
         Auto +len
       </label>
+      <label>
+        <input id='live' type='checkbox'>
+        Sans cache
+      </label>
       <label>
         <input id='scanStop' type='checkbox' checked>
         Stop à la 1re zone valide
@@ -2281,6 +3103,7 @@ const inpScanStep = $("#scanStep");
 const cbScanStop = $("#scanStop");
 const cbScanAuto = $("#scanAuto");
 const cbAuto = $("#auto");
+const cbLive = $("#live");
 const selRef = $("#refresh");
 const btnRead = $("#btnRead");
 const btnScan = $("#btnScan");
@@ -2321,6 +3144,7 @@ async function readOnce(){
   const len = parseInt(inpLen.value || "16", 10);
   const qs = "?start=" + encodeURIComponent(start) +
              "&len=" + encodeURIComponent(len) +
+             (cbLive.checked ? "&maxAge=0" : "") +
              "&_=" + Date.now();
   try{
     const r = await fetch("/api/memory" + qs, { cache:"no-store" });
@@ -2330,10 +3154,11 @@ async function readOnce(){
       return;
     }
     renderDump(j.startHex || start, j.words || []);
+    const perf = " – " + (j.requests || 0) + " requêtes, " + (j.cacheHits || 0) + " blocs en cache, " + (j.wordsPerSec || 0) + " mots/s";
     if(j.errors && j.errors.length){
-      showMsg("Lecture partielle: " + j.errors.length + " erreurs.", false);
+      showMsg("Lecture partielle: " + j.errors.length + " erreurs" + perf + ".", false);
     } else {
-      showMsg("Lecture OK (" + (j.words ? j.words.length : 0) + " mots).", true);
+      showMsg("Lecture OK (" + (j.words ? j.words.length : 0) + " mots" + perf + ").", true);
     }
     if(cbAuto.checked && j.startHex && j.words){
       const next = (parseInt(j.startHex,16) + j.words.length) & 0xFFFF;
@@ -2355,6 +3180,7 @@ async function scanOnce(){
              "&max=" + encodeURIComponent(max) +
              "&step=" + encodeURIComponent(step) +
              "&stopOnValid=" + encodeURIComponent(stopOnValid) +
+             (cbLive.checked ? "&maxAge=0" : "") +
              "&_=" + Date.now();
   try{
     const r = await fetch("/api/memory/scan" + qs, { cache:"no-store" });
@@ -2364,7 +3190,7 @@ async function scanOnce(){
       return;
     }
     if(j.found){
-      showMsg("Zone valide: " + j.addr + " = " + j.value + " (scan " + j.scanned + ")", true);
+      showMsg("Zone valide: " + j.addr + " = " + j.value + " (scan " + j.scanned + ", " + (j.requests || 0) + " requêtes)", true);
       inpStart.value = j.addr;
       readOnce();
     } else {
@@ -2505,7 +3331,7 @@ String Portal::logsRadioHtml() {
   </div>
 
   <div class='card'>
-    <h2>Trames radio (niveau RADIO)</h2>
+    <h2>Trames radio</h2>
     <div class='toolbar'>
       <label>Rafraîchissement
         <select id='refresh'>
@@ -2517,6 +3343,31 @@ String Portal::logsRadioHtml() {
         </select>
       </label>
 
+      <label>Appareil
+        <select id='device'>
+          <option value=''>Tous</option>
+          <option value='0x80'>Chaudière</option>
+          <option value='0x08'>Zone 1</option>
+          <option value='0x09'>Zone 2</option>
+          <option value='0x0A'>Zone 3</option>
+          <option value='0x20'>Sonde extérieure</option>
+          <option value='0x7E'>Connect</option>
+        </select>
+      </label>
+
+      <label>Type
+        <select id='type'>
+          <option value=''>Tous</option>
+          <option value='0x03'>READ</option>
+          <option value='0x17'>INIT</option>
+          <option value='0x41'>ASSOCIATION</option>
+        </select>
+      </label>
+
+      <label>Adresse
+        <input id='address' type='text' size='7' placeholder='ex: 79E0'>
+      </label>
+
       <label>Filtre texte
         <input id='filter' type='text' placeholder='rechercher...'>
       </label>
@@ -2557,20 +3408,25 @@ String Portal::logsRadioHtml() {
   </div>
 
   <div class='muted' style='text-align:center'>
-    Cette page affiche uniquement les logs avec le niveau <code>RADIO</code>
-    (filtrés côté backend via <code>level=RADIO</code>).
+    Trames brutes émises et reçues, décodées à l'affichage. Appareil, type et adresse
+    (zone mémoire lue ou écrite) sont filtrés par l'appareil via <code>/api/radio/frames</code>.
   </div>
 
 </div>
 
 <script>
 const $ = s => document.querySelector(s);
-let raw = "";
+const kMaxClientFrames = 2000;
+let frames = [];
+let cursor = 0;          // Numéro de la prochaine trame attendue (X-Frames-Next)
 let timer = null;
 
 const elLog     = $("#log");
 const selRef    = $("#refresh");
 const selLimit  = $("#limit");
+const selDevice = $("#device");
+const selType   = $("#type");
+const inpAddr   = $("#address");
 const inpFilter = $("#filter");
 const cbAuto    = $("#autoscroll");
 const btnReload = $("#btnReload");
@@ -2589,11 +3445,32 @@ function showMsg(text, ok){
   msgBox.className = "msg show " + (ok ? "ok" : "err");
 }
 
-function applyFilters(txt){
-  if(!txt) return "";
-  let lines = txt.split("\n");
+const hex2 = v => v.toString(16).toUpperCase().padStart(2,"0");
+const hex4 = v => v.toString(16).toUpperCase().padStart(4,"0");
 
-  const f   = inpFilter.value.trim().toLowerCase();
+function pad(n){ return String(n).padStart(2,"0"); }
+
+function formatFrame(f){
+  const d = new Date(f.time * 1000);
+  let line = "[" + d.getUTCFullYear() + "-" + pad(d.getUTCMonth()+1) + "-" + pad(d.getUTCDate()) + " " +
+             pad(d.getUTCHours()) + ":" + pad(d.getUTCMinutes()) + ":" + pad(d.getUTCSeconds()) + "]";
+  line += "[" + f.dir + "][" + f.len + "]";
+  if(f.rssi !== undefined) line += "[" + f.rssi.toFixed(0) + " dBm]";
+  line += " " + f.issue.padEnd(11);
+  if(f.from !== undefined){
+    line += " " + hex2(f.from) + ">" + hex2(f.to) + " " + f.type + (f.ack ? " ACK" : "") +
+            " msg=" + hex2(f.msg);
+  }
+  if(f.words !== undefined) line += " @" + hex4(f.addr) + "/" + f.words;
+  if(f.writeWords !== undefined) line += " w@" + hex4(f.writeAddr) + "/" + f.writeWords;
+  line += " | " + (f.hex.match(/../g) || []).join(" ");
+  return line;
+}
+
+function applyFilters(){
+  let lines = frames.map(formatFrame);
+
+  const f = inpFilter.value.trim().toLowerCase();
   if(f){
     lines = lines.filter(l => l.toLowerCase().includes(f));
   }
@@ -2607,33 +3484,58 @@ function applyFilters(txt){
 }
 
 function render(){
-  const out = applyFilters(raw);
+  const out = applyFilters();
   elLog.textContent = out || "(vide)";
   if(cbAuto.checked){
     elLog.scrollTop = elLog.scrollHeight;
   }
 }
 
-async function reload(){
-  if(pollInFlight || pollStopped) return;
+function filterParams(){
+  let qs = "";
+  if(selDevice.value) qs += "&device=" + encodeURIComponent(selDevice.value);
+  if(selType.value) qs += "&type=" + encodeURIComponent(selType.value);
+  const addr = inpAddr.value.trim();
+  if(addr) qs += "&address=" + encodeURIComponent("0x" + addr.replace(/^0x/i,""));
+  return qs;
+}
+
+// full : dernières trames ; sinon uniquement celles postérieures au curseur
+async function fetchFrames(full){
+  if(pollInFlight || (!full && pollStopped)) return;
   pollInFlight = true;
   try{
-    const limitParam = selLimit.value === "0" ? "500" : selLimit.value;
-    const qs =
-      "?limit=" + encodeURIComponent(limitParam) +
-      "&level=RADIO&_=" + Date.now();
+    const limitParam = selLimit.value === "0" ? "300" : selLimit.value;
+    const qs = "?limit=" + encodeURIComponent(limitParam) + filterParams() +
+               (full ? "" : "&since=" + cursor) + "&_=" + Date.now();
 
-    const r = await fetch("/api/logs"+qs,{cache:"no-store"});
-    const arr = await r.json();   // ["ligne1", "ligne2", ...]
-    raw = arr.join("\n");
-    render();
+    const r = await fetch("/api/radio/frames"+qs,{cache:"no-store"});
+    if(!r.ok){
+      showMsg("Filtre invalide.", false);
+      return;
+    }
+    const arr = await r.json();   // [{seq, dir, issue, hex, ...}, ...]
+    const next = parseInt(r.headers.get("X-Frames-Next")||"0",10);
+    if(full || next < cursor){
+      frames = [];
+    }
+    cursor = next;
+    if(full || arr.length){
+      frames.push(...arr);
+      if(frames.length > kMaxClientFrames){
+        frames.splice(0, frames.length - kMaxClientFrames);
+      }
+      render();
+    }
   }catch(e){
-    elLog.textContent = "Erreur chargement logs: " + e;
+    elLog.textContent = "Erreur chargement trames: " + e;
   } finally {
     pollInFlight = false;
   }
 }
 
+const reload = () => fetchFrames(true);
+
 function stopPolling(){
   pollStopped = true;
   if(timer){ clearTimeout(timer); timer = null; }
@@ -2650,7 +3552,7 @@ function scheduleNextPoll(){
   if(v>0){
     if(timer){ clearTimeout(timer); timer = null; }
     timer = setTimeout(async ()=>{
-      await reload();
+      await fetchFrames(false);
       scheduleNextPoll();
     }, v);
   }
@@ -2690,9 +3592,8 @@ async function sendPayload(){
     try {
       const j = JSON.parse(txt);
       if(j.ok){
-        showMsg("Trame envoyée (voir logs RADIO).", true);
-        // éventuellement on recharge les logs
-        reload();
+        showMsg("Trame envoyée.", true);
+        fetchFrames(false);
       } else {
         showMsg("Erreur envoi trame : " + (j.err || "inconnue"), false);
       }
@@ -2708,13 +3609,13 @@ document.addEventListener("DOMContentLoaded", ()=>{
   btnReload.addEventListener("click", reload);
   btnClear.addEventListener("click", async ()=>{
     try{
-      await fetch("/api/logs/clear",{method:"POST"});
-      raw = "";
+      await fetch("/api/radio/frames/clear",{method:"POST"});
+      frames = [];
       render();
-      showMsg("Logs effacés.", true);
+      showMsg("Trames effacées.", true);
     }catch(e){
-      console.error("Erreur clear logs", e);
-      showMsg("Erreur lors de l'effacement des logs.", false);
+      console.error("Erreur effacement trames", e);
+      showMsg("Erreur lors de l'effacement des trames.", false);
     }
   });
 
@@ -2722,6 +3623,11 @@ document.addEventListener("DOMContentLoaded", ()=>{
     el.addEventListener("input", render);
   });
 
+  // Filtres appliqués par l'appareil : rechargement complet
+  [selDevice, selType, inpAddr].forEach(el=>{
+    el.addEventListener("change", reload);
+  });
+
   selRef.addEventListener("change", updateRefreshTimer);
 
   if(btnSend){
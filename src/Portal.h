@@ -5,11 +5,12 @@
 #include "Config.h"
 #include "Logs.h"
 #include "FrisquetManager.h"
+#include "LogArchive.h"
 
 // Portail Web de configuration + logs (adapté à ton Config)
 class Portal {
 public:
-  explicit Portal(FrisquetManager& frisquetManager, uint16_t port = 80);
+  Portal(FrisquetManager& frisquetManager, LogArchive& archive, uint16_t port = 80);
 
   // startApFallbackIfNoWifi = monte un AP "ESP32-Setup" si pas de Wi-Fi actif
   void begin(bool startApFallbackIfNoWifi = false);
@@ -18,6 +19,7 @@ public:
 private:
   WebServer _srv;
   FrisquetManager& _frisquetManager;
+  LogArchive& _archive;
 
   // AP fallback
   bool _apRunning = false;
@@ -31,13 +33,17 @@ private:
   void handlePostConfig();       // POST /api/config
   void handleReboot();           // POST /api/reboot
   void handleGetLogs();          // GET /api/logs
+  void handleLogStream();        // GET /api/logs/stream
   void handleLogsPage();         // GET /logs
   void handleClearLogs();        // GET /logs/clear
+  void handleLogArchive();       // GET /api/logs/archive
   void handleMemoryRead();       // GET /api/memory
   void handleMemoryScan();       // GET /api/memory/scan
   void handleMemoryPage();       // GET /memory
   void handleStatus();
   void handleRadioLogsPage();
+  void handleRadioFrames();      // GET /api/radio/frames
+  void handleClearRadioFrames(); // POST /api/radio/frames/clear
   void handleSendRadio();
   void handlePairConnect();
   void handlePairSondeExt();
@@ -45,6 +51,7 @@ private:
   void handlePairSatelliteZ2();
   void handlePairSatelliteZ3();
   void handleRecupNetworkId();
+  void handleCalibrateRadio();   // POST /api/radio/calibrate
 
 
   // Utils
@@ -53,8 +60,47 @@ private:
   static String memoryHtml();
   String logsRadioHtml();
   void scheduleReboot(uint32_t delayMs = 800);
+  // Commande radio refusée (503) ou sans résultat dans son délai (504) : réponse envoyée, true
+  bool sendRadioUnavailable(int16_t err);
   bool hexStringToBufferRaw(const String& hex, uint8_t* buffer, size_t maxLen, size_t& outLen);
 
+  // Lecture mémoire chaudière par blocs
+  static constexpr uint16_t kMemoryMaxBlockWords = 0x20;
+  static constexpr int16_t kErrMemoryReply = -1200;     // Réponse trop courte ou longueur annoncée incohérente
+  static constexpr uint32_t kMemoryCacheMaxAgeMs = 10000;   // Mots plus récents dans radio.memoire() : servis sans lecture
+  struct MemoryReadStats {
+    uint32_t maxAgeMs = kMemoryCacheMaxAgeMs;   // 0 : toujours lus sur la radio (?maxAge=0)
+    uint16_t requests = 0;                      // Lectures radio
+    uint16_t cacheHits = 0;                     // Blocs servis par le cache
+    uint16_t wordsRead = 0;
+    uint32_t elapsedMs = 0;
+
+    float wordsPerSecond() const { return elapsedMs > 0 ? wordsRead * 1000.0f / elapsedMs : 0.0f; }
+  };
+  // Rappel par mot lu : value = -1 en cas d'échec (err), retourne false pour arrêter la lecture
+  typedef std::function<bool(uint16_t addr, int32_t value, int16_t err)> MemoryWordCallback;
+
+  bool memorySender(uint8_t& idExpediteur, uint8_t& idAssociation);
+  int16_t readMemoryBlock(uint8_t idExpediteur, uint8_t idAssociation, uint16_t addr, uint16_t count, uint16_t* words,
+                          MemoryReadStats& stats);
+  bool parseMaxAgeArg(MemoryReadStats& stats);
+  void readMemoryRange(uint8_t idExpediteur, uint8_t idAssociation, uint16_t start, uint16_t count,
+                       const MemoryWordCallback& onWord, MemoryReadStats& stats);
+
+  // Flux SSE des logs : chaque abonné garde son curseur et reçoit les nouvelles entrées dans loop()
+  static constexpr uint8_t kMaxLogStreams = 2;
+  static constexpr size_t kLogStreamBatch = 16;             // Entrées envoyées au plus par tour de boucle
+  static constexpr uint32_t kLogStreamKeepAliveMs = 15000;
+  struct LogStream {
+    WiFiClient client;
+    uint32_t seq = 0;
+    String level;
+    uint32_t lastWriteMs = 0;
+    bool actif = false;
+  };
+  LogStream _logStreams[kMaxLogStreams];
+  void pushLogStreams();
+
   // AP
   void startAp();
 };
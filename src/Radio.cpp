@@ -4,9 +4,18 @@ Radio::Radio() : _radio(new Module(SS, DIO0, RST_LoRa, BUSY_LoRa)) {}
 
 void Radio::init() {
     _radio.beginFSK();
-    _radio.setFrequency(868.96);
+    _radio.setFrequency(kFrequencyMHz);
     _radio.setBitRate(25.0);
     _radio.setFrequencyDeviation(50.0);
-    _radio.setRxBandwidth(250.0);
+    _radio.setRxBandwidth(kRxBandwidthKHz);
     _radio.setPreambleLength(4);
 }
+
+int16_t Radio::setChannel(float frequencyMHz, float rxBandwidthKHz) {
+    _radio.standby();
+    int16_t err = _radio.setFrequency(frequencyMHz);
+    if(err != RADIOLIB_ERR_NONE) {
+        return err;
+    }
+    return _radio.setRxBandwidth(rxBandwidthKHz);
+}
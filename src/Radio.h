@@ -2,27 +2,31 @@
 
 #include <heltec.h>
 #include <RadioLib.h>
+#include "RadioTransport.h"
 
 #define SS GPIO_NUM_8
 #define RST_LoRa GPIO_NUM_12
 #define BUSY_LoRa GPIO_NUM_13
 #define DIO0 GPIO_NUM_14
 
-class Radio {
+// Transport radio sur le SX1262 de la Heltec V3
+class Radio : public RadioTransport {
 
     public:
         Radio();
-        void init();
+        void init() override;
 
-        int16_t startReceive() { return _radio.startReceive(); }
-        int16_t receive(uint8_t data[], size_t len) { return _radio.receive(data, len); }
-        int16_t readData(uint8_t data[], size_t len) { return _radio.readData(data, len); }
-        int16_t transmit(byte data[], size_t len) { return _radio.transmit(data, len); }
-        size_t getPacketLength() { return _radio.getPacketLength(); }
-        void onReceive(void (*func)()) { _radio.setPacketReceivedAction(func);}
-        void setSyncWord(uint8_t* syncWord, size_t len) { _radio.setSyncWord(syncWord, len); }
+        int16_t startReceive() override { return _radio.startReceive(); }
+        int16_t receive(uint8_t data[], size_t len) override { return _radio.receive(data, len); }
+        int16_t readData(uint8_t data[], size_t len) override { return _radio.readData(data, len); }
+        int16_t transmit(uint8_t data[], size_t len) override { return _radio.transmit(data, len); }
+        size_t getPacketLength() override { return _radio.getPacketLength(); }
+        float getRSSI() override { return _radio.getRSSI(); }
+        bool isChannelFree(float thresholdDbm) override { return _radio.getRSSI(false) < thresholdDbm; } // RSSI instantané, en réception
+        void onReceive(void (*func)()) override { _radio.setPacketReceivedAction(func);}
+        void setSyncWord(uint8_t* syncWord, size_t len) override { _radio.setSyncWord(syncWord, len); }
+        int16_t setChannel(float frequencyMHz, float rxBandwidthKHz) override;
 
     private:
         SX1262 _radio;
 };
-
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Codes d'erreur et taille de trame : ceux de RadioLib sur la cible,
+// repris à l'identique pour les compilations hôte sans RadioLib.
+#if defined(ARDUINO) || __has_include(<RadioLib.h>)
+#include <RadioLib.h>
+#else
+#define RADIOLIB_ERR_NONE                   (0)
+#define RADIOLIB_ERR_UNKNOWN                (-1)
+#define RADIOLIB_ERR_PACKET_TOO_LONG        (-4)
+#define RADIOLIB_ERR_TX_TIMEOUT             (-5)
+#define RADIOLIB_ERR_RX_TIMEOUT             (-6)
+#define RADIOLIB_ERR_CRC_MISMATCH           (-7)
+#define RADIOLIB_SX126X_MAX_PACKET_LENGTH   255
+#endif
+
+// Couche physique vue par le protocole Frisquet : le SX1262 sur la carte (Radio),
+// un canal simulé sur poste de développement (SimulatedChannel).
+class RadioTransport {
+    public:
+        virtual ~RadioTransport() {}
+
+        // Canal Frisquet nominal, avant correction de l'écart du quartz
+        static constexpr float kFrequencyMHz = 868.96f;
+        static constexpr float kRxBandwidthKHz = 156.2f;
+
+        virtual void init() = 0;
+
+        virtual int16_t startReceive() = 0;
+        virtual int16_t receive(uint8_t data[], size_t len) = 0;
+        virtual int16_t readData(uint8_t data[], size_t len) = 0;
+        virtual int16_t transmit(uint8_t data[], size_t len) = 0;
+        virtual size_t getPacketLength() = 0;
+        virtual float getRSSI() = 0;
+        virtual void onReceive(void (*func)()) = 0;
+        virtual void setSyncWord(uint8_t* syncWord, size_t len) = 0;
+
+        // Écoute avant émission : false si l'énergie reçue sur le canal dépasse le seuil.
+        // Transports sans mesure : canal toujours considéré libre.
+        virtual bool isChannelFree(float /* thresholdDbm */) { return true; }
+
+        // Fréquence porteuse et bande passante de réception (pas discrets du SX1262).
+        // Le transport repasse en attente : la réception est relancée par l'appelant.
+        virtual int16_t setChannel(float /* frequencyMHz */, float /* rxBandwidthKHz */) { return RADIOLIB_ERR_NONE; }
+
+        // Avance les transports sans interruption matérielle (livraison des trames simulées)
+        virtual void service() {}
+};
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+// Arène circulaire d'entrées de taille variable, numérotées dans l'ordre d'ajout. Chaque
+// entrée commence par un en-tête Entete dont le premier champ est `uint16_t taille` (entrée
+// complète ; 0 : fin de l'arène, reprise au début) et qui porte un `uint32_t seq`. Les
+// entrées les plus anciennes sont oubliées pour faire place aux nouvelles.
+// Utilisée par Logs et RadioFrameLog : l'appelant prend le verrou autour de chaque accès.
+template <typename Entete, size_t kTaille>
+class RingArena {
+    static_assert(offsetof(Entete, taille) == 0, "La taille ouvre l'en-tête : 0 marque la fin de l'arène");
+
+    public:
+        // Pris par le journal propriétaire autour de chaque accès
+        struct Verrou {
+            explicit Verrou(RingArena& owner) : _lock(owner._mutex) {}
+
+            std::lock_guard<std::mutex> _lock;
+        };
+
+        // En-tête (taille et seq renseignés ici) suivi du corps ; retourne la position de l'entrée
+        size_t ajouter(Entete& e, const uint8_t* corps, size_t length) {
+            size_t taille = sizeof(Entete) + length;
+            e.taille = taille;
+            e.seq = _prochainSeq++;
+
+            // Place libre à la position d'écriture, quitte à oublier les entrées les plus anciennes
+            for(;;) {
+                if(_count == 0) {
+                    _debut = _fin = 0;
+                    break;
+                }
+                if(_fin > _debut) {     // Entrées contiguës [_debut, _fin)
+                    if(kTaille - _fin >= taille) {
+                        break;
+                    }
+                    if(kTaille - _fin >= sizeof(Entete)) {
+                        uint16_t fin = 0;
+                        memcpy(&_arena[_fin], &fin, sizeof(fin));
+                    }
+                    _fin = 0;
+                    continue;
+                }
+                // Entrées en deux morceaux [_debut, fin de l'arène) puis [0, _fin)
+                if(_debut - _fin >= taille) {
+                    break;
+                }
+                oublierPlusAncienne();
+            }
+
+            size_t offset = _fin;
+            memcpy(&_arena[offset], &e, sizeof(e));
+            memcpy(&_arena[offset + sizeof(Entete)], corps, length);
+            _fin += taille;
+            _used += taille;
+            ++_count;
+            return offset;
+        }
+
+        Entete entete(size_t offset) const {
+            Entete e;
+            memcpy(&e, &_arena[offset], sizeof(e));
+            return e;
+        }
+
+        // Entrée complète, en-tête compris (copie, mise à jour d'un champ en place)
+        uint8_t* entree(size_t offset) { return &_arena[offset]; }
+        const uint8_t* corps(size_t offset) const { return &_arena[offset + sizeof(Entete)]; }
+
+        size_t premiere() const { return _debut; }
+        size_t suivante(size_t offset) const {
+            uint16_t taille;
+            memcpy(&taille, &_arena[offset], sizeof(taille));
+            offset += taille;
+            if(kTaille - offset < sizeof(Entete)) {
+                return 0;
+            }
+            memcpy(&taille, &_arena[offset], sizeof(taille));
+            return taille == 0 ? 0 : offset;
+        }
+
+        uint32_t premierSeq() const { return _count > 0 ? entete(_debut).seq : _prochainSeq; }
+        uint32_t prochainSeq() const { return _prochainSeq; }
+        size_t entrees() const { return _count; }
+        size_t octetsUtilises() const { return _used; }
+
+        // Première entrée de numéro >= seq retenue par correspond(entete, offset). Numéros
+        // consécutifs : reprise depuis la dernière entrée trouvée si elle est toujours présente
+        template <typename Filtre>
+        bool trouver(uint32_t seq, Filtre correspond, size_t& trouvee) {
+            if(_count == 0 || seq >= _prochainSeq) {
+                return false;
+            }
+
+            size_t offset = _debut;
+            size_t i = 0;
+            uint32_t premier = entete(_debut).seq;
+            if(_repereSeq >= premier && _repereSeq <= seq) {
+                offset = _repereOffset;
+                i = _repereSeq - premier;
+            }
+
+            for(; i < _count; ++i, offset = suivante(offset)) {
+                Entete e = entete(offset);
+                if(e.seq >= seq && correspond(e, offset)) {
+                    _repereSeq = e.seq;
+                    _repereOffset = offset;
+                    trouvee = offset;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template <typename Filtre>
+        size_t compter(Filtre correspond) const {
+            size_t total = 0;
+            size_t offset = _debut;
+            for(size_t i = 0; i < _count; ++i, offset = suivante(offset)) {
+                if(correspond(entete(offset), offset)) {
+                    ++total;
+                }
+            }
+            return total;
+        }
+
+        // Numéro de la première des `limit` dernières entrées retenues
+        template <typename Filtre>
+        uint32_t chercherDebut(size_t limit, Filtre correspond) const {
+            size_t total = compter(correspond);
+            size_t ignorer = total > limit ? total - limit : 0;
+            size_t offset = _debut;
+            for(size_t i = 0; i < _count; ++i, offset = suivante(offset)) {
+                Entete e = entete(offset);
+                if(!correspond(e, offset)) {
+                    continue;
+                }
+                if(ignorer-- == 0) {
+                    return e.seq;
+                }
+            }
+            return _prochainSeq;
+        }
+
+        void vider() {
+            _count = 0;
+            _used = 0;
+            _debut = 0;
+            _fin = 0;
+            _repereSeq = 0;
+        }
+
+    private:
+        void oublierPlusAncienne() {
+            _used -= entete(_debut).taille;
+            _debut = suivante(_debut);
+            --_count;
+        }
+
+        uint8_t _arena[kTaille];
+        size_t _debut = 0;              // Entrée la plus ancienne
+        size_t _fin = 0;                // Prochaine écriture
+        size_t _count = 0;
+        size_t _used = 0;
+        uint32_t _prochainSeq = 1;
+        uint32_t _repereSeq = 0;        // Dernière entrée trouvée, pour reprendre la lecture sans tout parcourir
+        size_t _repereOffset = 0;
+        std::mutex _mutex;
+};
@@ -0,0 +1,287 @@
+#include "BoilerEmulator.h"
+
+const BoilerEmulator::Region BoilerEmulator::kRegions[] = {
+    { 0x79E0, 0x001C, "informations" },
+    { 0x7AA8, 0x001C, "informations (0x84)" },
+    { 0x7A18, 0x001C, "consommation" },
+    { 0x7AE0, 0x001C, "consommation (0x84)" },
+    { 0x9C54, 0x0004, "sonde" },
+    { 0xA029, 0x0015, "satellites" },         // Inclut la date en 0xA02B et les zones en 0xA02F + 5 * (zone - 1)
+    { 0xA0FC, 0x0001, "mode ECS" },
+    { 0xA154, 0x0018, "zones" },
+};
+const size_t BoilerEmulator::kRegionCount = sizeof(kRegions) / sizeof(kRegions[0]);
+
+static const uint8_t kBroadcast[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+
+static uint8_t toBcd(uint8_t value) {
+    return ((value / 10) << 4) | (value % 10);
+}
+
+static uint16_t temperature(float value) {
+    return (uint16_t)(int16_t)(value * 10.0f);
+}
+
+BoilerEmulator::BoilerEmulator(SimulatedChannel::Endpoint& endpoint, const uint8_t networkId[4])
+    : _endpoint(endpoint), _memoire(0x10000, 0x0000) {
+    memcpy(_networkId, networkId, sizeof(_networkId));
+    initialiserMemoire();
+    setSyncWord(_networkId);
+    _endpoint.startReceive();
+}
+
+void BoilerEmulator::initialiserMemoire() {
+    // Informations (0x79E0) : ECS, CDC, départs, pression, ambiances, consignes, extérieure
+    ecrireMot(0x79E0, temperature(55.0f));
+    ecrireMot(0x79E1, temperature(45.0f));
+    ecrireMot(0x79E2, temperature(38.5f));
+    ecrireMot(0x79E3, temperature(35.0f));
+    ecrireMot(0x79E4, temperature(30.0f));
+    ecrireMot(0x79EA, (uint16_t)(1.5f * 5120.0f));
+    ecrireMot(0x79EC, temperature(52.0f));
+    ecrireMot(0x79F2, temperature(20.5f));
+    ecrireMot(0x79F3, temperature(19.5f));
+    ecrireMot(0x79F4, temperature(18.5f));
+    ecrireMot(0x79F8, temperature(20.0f));
+    ecrireMot(0x79F9, temperature(19.0f));
+    ecrireMot(0x79FA, temperature(18.0f));
+    ecrireMot(0x79FB, temperature(8.5f));
+    for(uint16_t i = 0; i < 0x001C; i++) {
+        ecrireMot(0x7AA8 + i, lireMot(0x79E0 + i));
+    }
+
+    // Consommation (0x7A18) : ECS puis chauffage, en kWh
+    ecrireMot(0x7A21, 12);
+    ecrireMot(0x7A22, 34);
+    for(uint16_t i = 0; i < 0x001C; i++) {
+        ecrireMot(0x7AE0 + i, lireMot(0x7A18 + i));
+    }
+
+    // Satellites (0xA029) : extérieure, état chaudière 0x28 (fonctionnement), zones
+    ecrireMot(0xA029, temperature(8.5f));
+    ecrireMot(0xA02E, 0x2801);
+    for(uint8_t zone = 0; zone < 3; zone++) {
+        uint16_t adresse = 0xA02F + 0x0005 * zone;
+        ecrireMot(adresse, temperature(20.5f - zone));
+        ecrireMot(adresse + 1, temperature(20.0f - zone));
+        ecrireMot(adresse + 2, 0x0005);     // Mode auto
+    }
+
+    // Mode ECS (0xA0FC) : Eco
+    ecrireMot(0xA0FC, 0x0009);
+
+    setDate(25, 1, 1, 12, 0, 0);
+}
+
+void BoilerEmulator::setDate(uint8_t annee, uint8_t mois, uint8_t jour, uint8_t heure, uint8_t minute, uint8_t seconde) {
+    uint16_t date[3] = {
+        (uint16_t)(toBcd(annee) << 8 | toBcd(mois)),
+        (uint16_t)(toBcd(jour) << 8 | toBcd(heure)),
+        (uint16_t)(toBcd(minute) << 8 | toBcd(seconde)),
+    };
+    for(uint8_t i = 0; i < 3; i++) {
+        ecrireMot(0xA02B + i, date[i]);
+        ecrireMot(0x9C54 + i, date[i]);
+    }
+}
+
+bool BoilerEmulator::estAccessible(uint16_t adresse, uint16_t taille) const {
+    uint32_t fin = (uint32_t)adresse + taille;
+    for(size_t i = 0; i < kRegionCount; i++) {
+        if(adresse >= kRegions[i].adresse && fin <= (uint32_t)kRegions[i].adresse + kRegions[i].taille) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BoilerEmulator::loop() {
+    _endpoint.service();
+
+    uint8_t buff[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    while(_endpoint.available() > 0) {
+        if(_endpoint.readData(buff, 0) != RADIOLIB_ERR_NONE) {
+            continue;
+        }
+        onFrame(buff, _endpoint.getPacketLength());
+    }
+
+    if(_association.active && (int32_t)(_endpoint.getChannel().now() - _association.prochaineEmission) >= 0) {
+        emettreAssociation();
+        _association.prochaineEmission = _endpoint.getChannel().now() + _association.periodeMs;
+    }
+}
+
+void BoilerEmulator::onFrame(const uint8_t* data, size_t length) {
+    RadioTrameHeader header;
+    if(length < sizeof(header)) {
+        ++_stats.ignored;
+        return;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    const uint8_t* body = data + sizeof(header);
+    size_t bodyLength = length - sizeof(header);
+
+    if(_association.active && header.type == RadioMessageType::ASSOCIATION) {
+        onAssociationConfirm(header, body, bodyLength);
+        return;
+    }
+
+    if(header.idDestinataire != ID_CHAUDIERE || header.isAck()) {
+        ++_stats.ignored;
+        return;
+    }
+
+    switch(header.type) {
+        case RadioMessageType::READ:
+            onRead(header, body, bodyLength);
+            break;
+        case RadioMessageType::INIT:
+            onInit(header, body, bodyLength);
+            break;
+        default:
+            ++_stats.ignored;
+            break;
+    }
+}
+
+void BoilerEmulator::onRead(const RadioTrameHeader& header, const uint8_t* body, size_t length) {
+    RadioTrameAsk requete;
+    if(length < sizeof(requete)) {
+        ++_stats.ignored;
+        return;
+    }
+    memcpy(&requete, body, sizeof(requete));
+
+    uint16_t adresse = requete.adresseMemoire.toUInt16();
+    uint16_t taille = requete.tailleMemoire.toUInt16();
+    if(!estAccessible(adresse, taille)) {
+        refuser(header);
+        return;
+    }
+
+    ++_stats.reads;
+    repondre(header, adresse, taille);
+}
+
+void BoilerEmulator::onInit(const RadioTrameHeader& header, const uint8_t* body, size_t length) {
+    RadioTrameInit requete;
+    if(length < sizeof(requete)) {
+        ++_stats.ignored;
+        return;
+    }
+    memcpy(&requete, body, sizeof(requete));
+
+    uint16_t adresseLecture = requete.adresseMemoireLecture.toUInt16();
+    uint16_t tailleLecture = requete.tailleMemoireLecture.toUInt16();
+    uint16_t adresseEcriture = requete.adresseMemoireEcriture.toUInt16();
+    uint16_t tailleEcriture = requete.tailleMemoireEcriture.toUInt16();
+
+    if(!estAccessible(adresseLecture, tailleLecture) || !estAccessible(adresseEcriture, tailleEcriture) ||
+       length < sizeof(requete) + requete.longueurDonneesEcriture) {
+        refuser(header);
+        return;
+    }
+
+    // Écriture des mots fournis (au plus tailleEcriture), puis lecture de la zone demandée
+    const uint8_t* donnees = body + sizeof(requete);
+    uint16_t mots = requete.longueurDonneesEcriture / 2;
+    if(mots > tailleEcriture) {
+        mots = tailleEcriture;
+    }
+    for(uint16_t i = 0; i < mots; i++) {
+        ecrireMot(adresseEcriture + i, (uint16_t)(donnees[i * 2] << 8 | donnees[i * 2 + 1]));
+    }
+
+    ++_stats.inits;
+    repondre(header, adresseLecture, tailleLecture);
+}
+
+void BoilerEmulator::onAssociationConfirm(const RadioTrameHeader& header, const uint8_t* body, size_t length) {
+    // Confirmation : en-tête en réponse + NetworkID reçu
+    if(header.idExpediteur != _association.idDestinataire || header.idDestinataire != ID_CHAUDIERE ||
+       length < 4 || memcmp(body, _networkId, 4) != 0) {
+        ++_stats.ignored;
+        return;
+    }
+
+    ++_stats.associations;
+    _association.active = false;
+    setSyncWord(_networkId);
+}
+
+void BoilerEmulator::repondre(const RadioTrameHeader& header, uint16_t adresse, uint16_t taille) {
+    uint8_t payload[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    size_t longueur = sizeof(RadioTrameHeader) + 1 + taille * 2;
+    if(longueur > sizeof(payload)) {
+        refuser(header);
+        return;
+    }
+
+    RadioTrameHeader reponse;
+    RadioTrameHeader requete = header;
+    requete.answer(reponse);
+    memcpy(payload, &reponse, sizeof(reponse));
+
+    payload[sizeof(reponse)] = (uint8_t)(taille * 2);
+    uint8_t* donnees = &payload[sizeof(reponse) + 1];
+    for(uint16_t i = 0; i < taille; i++) {
+        uint16_t mot = lireMot(adresse + i);
+        donnees[i * 2] = mot >> 8;
+        donnees[i * 2 + 1] = mot & 0xFF;
+    }
+
+    emettre(payload, longueur);
+}
+
+void BoilerEmulator::refuser(const RadioTrameHeader& header) {
+    ++_stats.refused;
+
+    RadioTrameHeader reponse;
+    RadioTrameHeader requete = header;
+    requete.answer(reponse);
+    reponse.type = RadioMessageType::REFUS;
+    emettre((const uint8_t*)&reponse, sizeof(reponse));
+}
+
+void BoilerEmulator::emettre(const uint8_t* data, size_t length) {
+    uint8_t payload[RADIOLIB_SX126X_MAX_PACKET_LENGTH];
+    memcpy(payload, data, length);
+    _endpoint.transmit(payload, length);
+    _endpoint.startReceive();
+}
+
+void BoilerEmulator::demarrerAssociation(uint8_t idDestinataire, uint8_t idAssociation, uint32_t periodeMs) {
+    _association.active = true;
+    _association.idDestinataire = idDestinataire;
+    _association.idAssociation = idAssociation;
+    _association.periodeMs = periodeMs;
+    _association.prochaineEmission = _endpoint.getChannel().now();
+    setSyncWord(kBroadcast);
+}
+
+void BoilerEmulator::emettreAssociation() {
+    // 11 octets : en-tête, longueur, NetworkID (format attendu par FrisquetDevice::associer)
+    uint8_t payload[sizeof(RadioTrameHeader) + 1 + 4];
+
+    RadioTrameHeader header;
+    header.idDestinataire = _association.idDestinataire;
+    header.idExpediteur = ID_CHAUDIERE;
+    header.idAssociation = _association.idAssociation;
+    header.idMessage = ++_association.idMessage;
+    header.idReception = 0x01;
+    header.type = RadioMessageType::ASSOCIATION;
+
+    memcpy(payload, &header, sizeof(header));
+    payload[sizeof(header)] = 4;
+    memcpy(&payload[sizeof(header) + 1], _networkId, 4);
+
+    emettre(payload, sizeof(payload));
+}
+
+void BoilerEmulator::setSyncWord(const uint8_t networkId[4]) {
+    uint8_t syncWord[4];
+    memcpy(syncWord, networkId, sizeof(syncWord));
+    _endpoint.setSyncWord(syncWord, sizeof(syncWord));
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "SimulatedChannel.h"
+#include "../Frisquet/Trames.h"
+#include <vector>
+
+// Chaudière Frisquet émulée sur un point d'accès du canal simulé : répond aux
+// lectures (READ) et écritures/lectures (INIT) sur les zones mémoire connues,
+// refuse les autres adresses (0x83) et diffuse les trames d'association.
+class BoilerEmulator {
+    public:
+        struct Region {
+            uint16_t adresse;
+            uint16_t taille;        // En mots de 16 bits
+            const char* nom;
+        };
+
+        // Zones mémoire exploitées par le firmware
+        static const Region kRegions[];
+        static const size_t kRegionCount;
+
+        struct Stats {
+            uint32_t reads = 0;
+            uint32_t inits = 0;
+            uint32_t refused = 0;
+            uint32_t ignored = 0;
+            uint32_t associations = 0;
+        };
+
+        BoilerEmulator(SimulatedChannel::Endpoint& endpoint, const uint8_t networkId[4]);
+
+        // Traite les trames reçues et les émissions d'association en cours
+        void loop();
+
+        // Accès à la mémoire émulée (adresses en mots)
+        uint16_t lireMot(uint16_t adresse) const { return _memoire[adresse]; }
+        void ecrireMot(uint16_t adresse, uint16_t valeur) { _memoire[adresse] = valeur; }
+        bool estAccessible(uint16_t adresse, uint16_t taille) const;
+
+        // Date courante de la chaudière, servie en BCD (0xA02B et réponse sonde 0x9C54)
+        void setDate(uint8_t annee, uint8_t mois, uint8_t jour, uint8_t heure, uint8_t minute, uint8_t seconde);
+
+        // Diffuse des trames d'association vers idDestinataire jusqu'à sa confirmation
+        void demarrerAssociation(uint8_t idDestinataire, uint8_t idAssociation, uint32_t periodeMs = 500);
+        bool associationEnCours() const { return _association.active; }
+
+        const Stats& stats() const { return _stats; }
+
+    private:
+        struct Association {
+            bool active = false;
+            uint8_t idDestinataire = 0x00;
+            uint8_t idAssociation = 0x00;
+            uint8_t idMessage = 0x00;
+            uint32_t periodeMs = 0;
+            uint32_t prochaineEmission = 0;
+        };
+
+        void onFrame(const uint8_t* data, size_t length);
+        void onRead(const RadioTrameHeader& header, const uint8_t* body, size_t length);
+        void onInit(const RadioTrameHeader& header, const uint8_t* body, size_t length);
+        void onAssociationConfirm(const RadioTrameHeader& header, const uint8_t* body, size_t length);
+        void repondre(const RadioTrameHeader& header, uint16_t adresse, uint16_t taille);
+        void refuser(const RadioTrameHeader& header);
+        void emettre(const uint8_t* data, size_t length);
+        void emettreAssociation();
+        void setSyncWord(const uint8_t networkId[4]);
+        void initialiserMemoire();
+
+        SimulatedChannel::Endpoint& _endpoint;
+        uint8_t _networkId[4];
+        std::vector<uint16_t> _memoire;
+        Association _association;
+        Stats _stats;
+};
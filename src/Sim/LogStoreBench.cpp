@@ -0,0 +1,141 @@
+// Banc d'essai du journal persistant sur poste de développement : LogStore écrit dans
+// un répertoire ordinaire à la place de la partition LittleFS. Mélange de lignes de log
+// et de trames radio au format de LogArchive ; mesure le débit d'ajout, le volume et le
+// nombre d'écritures (usure), puis le temps d'une recherche par plage horaire.
+//
+// Compilation (depuis src/) :
+//   g++ -std=gnu++17 -O2 -I . -o /tmp/logstore-bench Sim/LogStoreBench.cpp LogStore.cpp
+// ou : pio run -e native_logstore && .pio/build/native_logstore/program
+//
+// Options : --repertoire chemin (/tmp/logstore), --enregistrements N,
+//           --trames pourcentage de trames radio, --par-seconde N enregistrements par seconde simulée
+
+#include "../LogStore.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct Parametres {
+    std::string repertoire = "/tmp/logstore";
+    uint32_t enregistrements = 200000;
+    uint32_t pourcentTrames = 30;
+    uint32_t parSeconde = 20;
+};
+
+bool lireParametres(int argc, char** argv, Parametres& parametres) {
+    for(int i = 1; i + 1 < argc; i += 2) {
+        std::string option(argv[i]);
+        const char* valeur = argv[i + 1];
+        if(option == "--repertoire") {
+            parametres.repertoire = valeur;
+        } else if(option == "--enregistrements") {
+            parametres.enregistrements = strtoul(valeur, nullptr, 10);
+        } else if(option == "--trames") {
+            parametres.pourcentTrames = strtoul(valeur, nullptr, 10);
+        } else if(option == "--par-seconde") {
+            parametres.parSeconde = strtoul(valeur, nullptr, 10);
+        } else {
+            fprintf(stderr, "Option inconnue : %s\n", argv[i]);
+            return false;
+        }
+    }
+    if(argc % 2 == 0 || parametres.parSeconde == 0) {
+        fprintf(stderr, "Usage : %s [--repertoire chemin] [--enregistrements N] [--trames %%] [--par-seconde N]\n", argv[0]);
+        return false;
+    }
+    return true;
+}
+
+// Segments d'une exécution précédente (noms de LogStore::chemin) : le banc part d'un journal vide
+void viderRepertoire(const std::string& repertoire) {
+    mkdir(repertoire.c_str(), 0755);
+    for(size_t i = 0; i < LogStore::kSegments; i++) {
+        char chemin[256];
+        snprintf(chemin, sizeof(chemin), "%s/logs%u.bin", repertoire.c_str(), (unsigned)i);
+        unlink(chemin);
+    }
+}
+
+double depuis(std::chrono::steady_clock::time_point debut) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+    Parametres parametres;
+    if(!lireParametres(argc, argv, parametres)) {
+        return 1;
+    }
+    viderRepertoire(parametres.repertoire);
+
+    LogStore store(parametres.repertoire.c_str());
+    if(!store.begin()) {
+        fprintf(stderr, "Répertoire inutilisable : %s\n", parametres.repertoire.c_str());
+        return 1;
+    }
+
+    // Trame : sens, RSSI et longueur en tête, comme LogArchive
+    uint8_t trame[3 + 64];
+    for(size_t i = 0; i < sizeof(trame); i++) {
+        trame[i] = (uint8_t)(i * 37);
+    }
+    char ligne[160];
+    const uint32_t debutTime = 1735689600;     // 2025-01-01, heure synchronisée
+    uint32_t rejetes = 0;
+
+    auto debut = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < parametres.enregistrements; i++) {
+        uint32_t time = debutTime + i / parametres.parSeconde;
+        uint32_t nowMs = (uint64_t)i * 1000 / parametres.parSeconde;
+        bool ok;
+        if(i % 100 < parametres.pourcentTrames) {
+            size_t longueur = 3 + 12 + i % 52;
+            ok = store.ajouter(LogStore::TRAME, i & 1, time, trame, longueur);
+        } else {
+            int n = snprintf(ligne, sizeof(ligne), "[RADIO] Réception données radio : %u bytes (RSSI -%u dBm)", 12 + i % 52, 60 + i % 30);
+            ok = store.ajouter(LogStore::JOURNAL, 1, time, (const uint8_t*)ligne, n);
+        }
+        if(!ok) {
+            ++rejetes;
+        }
+        store.loop(nowMs);
+    }
+    store.ecrire();
+    double secondes = depuis(debut);
+
+    // Recherche d'une minute au milieu de la période conservée
+    uint32_t dernier = debutTime + (parametres.enregistrements - 1) / parametres.parSeconde;
+    uint32_t premier = dernier;
+    store.parcourir(0, UINT32_MAX, [&premier](const LogStore::Enregistrement& e) {
+        premier = e.time;
+        return false;
+    });
+    uint32_t milieu = premier + (dernier - premier) / 2;
+    uint32_t trouves = 0;
+    auto debutRecherche = std::chrono::steady_clock::now();
+    store.parcourir(milieu, milieu + 59, [&trouves](const LogStore::Enregistrement&) {
+        ++trouves;
+        return true;
+    });
+    double secondesRecherche = depuis(debutRecherche);
+
+    const LogStore::Stats& stats = store.stats();
+    double simulees = (double)parametres.enregistrements / parametres.parSeconde;
+    printf("Enregistrements : %u ajoutés en %.3f s (%.0f/s), %u rejetés\n",
+        stats.enregistrements, secondes, stats.enregistrements / secondes, rejetes);
+    printf("Écritures : %u tampons, %.1f Mo (%.1f Mo/s), %u rotations, %u erreurs\n",
+        stats.ecritures, stats.octetsEcrits / 1e6, stats.octetsEcrits / secondes / 1e6, stats.rotations, stats.erreurs);
+    printf("Usure : %.1f écritures par heure simulée (%.1f h), %u octets conservés\n",
+        stats.ecritures / (simulees / 3600.0), simulees / 3600.0, (uint32_t)store.octetsStockes());
+    printf("Recherche : %u enregistrements sur une minute en %.3f ms\n", trouves, secondesRecherche * 1000.0);
+
+    store.end();
+    return 0;
+}
@@ -0,0 +1,164 @@
+// Banc d'essai du protocole sur poste de développement : FrisquetManager (Connect,
+// Satellite Z1 virtuel, sonde extérieure) échange avec BoilerEmulator sur un
+// SimulatedChannel, sur l'horloge virtuelle de src/Sim/host. Les appareils émettent
+// à tour de rôle ; le banc mesure les trames échangées par seconde de temps réel.
+//
+// Compilation (depuis src/) :
+//   g++ -std=gnu++17 -O2 -I Sim/host -I . -o /tmp/protocol-bench Sim/ProtocolBench.cpp
+//       Sim/SimulatedChannel.cpp Sim/BoilerEmulator.cpp Frisquet/*.cpp
+//       FrisquetManager.cpp Config.cpp Logs.cpp DS18B20.cpp
+// ou : pio run -e native_bench && .pio/build/native_bench/program
+//
+// Options : --transactions N, --perte 0..1, --corruption 0..1, --latence ms,
+//           --gigue ms, --ecart ms, --graine N, --verbeux
+
+#include <Arduino.h>
+#include <chrono>
+#include "../FrisquetManager.h"
+#include "SimulatedChannel.h"
+#include "BoilerEmulator.h"
+
+namespace {
+
+struct Parametres {
+    uint32_t transactions = 5000;
+    uint32_t ecartMs = 60000;       // Entre deux émissions d'appareil : budget d'émission (0,1 %) respecté
+    bool verbeux = false;
+    SimulatedChannel::Options canal;
+};
+
+bool lireParametres(int argc, char** argv, Parametres& parametres) {
+    for(int i = 1; i < argc; i++) {
+        String option(argv[i]);
+        if(option == "--verbeux") {
+            parametres.verbeux = true;
+            continue;
+        }
+        if(i + 1 >= argc) {
+            fprintf(stderr, "Valeur manquante pour %s\n", argv[i]);
+            return false;
+        }
+        String valeur(argv[++i]);
+        if(option == "--transactions") {
+            parametres.transactions = valeur.toInt();
+        } else if(option == "--perte") {
+            parametres.canal.lossRate = valeur.toFloat();
+        } else if(option == "--corruption") {
+            parametres.canal.corruptionRate = valeur.toFloat();
+        } else if(option == "--latence") {
+            parametres.canal.latencyMs = valeur.toInt();
+        } else if(option == "--gigue") {
+            parametres.canal.jitterMs = valeur.toInt();
+        } else if(option == "--ecart") {
+            parametres.ecartMs = valeur.toInt();
+        } else if(option == "--graine") {
+            parametres.canal.seed = valeur.toInt();
+        } else {
+            fprintf(stderr, "Option inconnue : %s\n", argv[i - 1]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Appareils associés, comme après un appairage sur la carte
+void preparerConfiguration(Config& cfg, const NetworkID& networkId) {
+    HostShim::preferences["connectCfg"]["idAssociation"] = { 0x01 };
+    HostShim::preferences["sondeExtCfg"]["idAssociation"] = { 0x02 };
+    HostShim::preferences["satCfgZ1"]["idAssociation"] = { 0x03 };
+
+    cfg.setNetworkID(networkId);
+    cfg.useConnect(true);
+    cfg.useSondeExterieure(true);
+    cfg.useZone1(true);
+    cfg.useSatelliteZ1(true);
+    cfg.useSatelliteVirtualZ1(true);
+}
+
+}
+
+int main(int argc, char** argv) {
+    Parametres parametres;
+    parametres.canal.rxTimeoutMs = 0;
+    if(!lireParametres(argc, argv, parametres)) {
+        return 1;
+    }
+    HostShim::serialEcho = parametres.verbeux;
+
+    const uint8_t reseau[4] = { 0x12, 0x34, 0x56, 0x78 };
+    SimulatedChannel canal(parametres.canal);
+    canal.setClock([]() { return (uint32_t)millis(); });
+
+    BoilerEmulator chaudiere(canal.createEndpoint(), reseau);
+    HostShim::idle = [&chaudiere]() {
+        chaudiere.loop();     // Attentes bloquantes du module : la chaudière répond pendant ce temps
+    };
+
+    Config cfg;
+    preparerConfiguration(cfg, NetworkID(reseau[0], reseau[1], reseau[2], reseau[3]));
+
+    WiFiClient client;
+    MqttManager mqtt(client);
+    FrisquetRadio radio(canal.createEndpoint());
+    FrisquetManager manager(radio, cfg, mqtt);
+    manager.begin();
+
+    Zone& zone = manager.connect().getZone1();
+    zone.setMode(Zone::MODE_ZONE::AUTO, true);
+    zone.setTemperatureAmbiante(19.5f);
+    zone.setTemperatureConsigne(20.0f);
+    manager.sondeExterieure().setTemperatureExterieure(8.5f);
+    manager.connect().setModeECS(Connect::MODE_ECS::ECO);
+
+    std::function<bool()> actions[] = {
+        [&manager]() { return manager.sondeExterieure().envoyerTemperatureExterieure(); },
+        [&manager]() { return manager.satelliteZ1().envoyerConsigne(); },
+        [&manager]() { return manager.connect().envoyerModeECS(); },
+        [&manager]() { return manager.connect().recupererInformations(); },
+    };
+    const size_t nbActions = sizeof(actions) / sizeof(actions[0]);
+
+    RadioTransactionEngine& transactions = radio.transactions();
+    auto terminees = [&transactions]() { return transactions.getCompleted() + transactions.getFailed(); };
+    uint32_t departTerminees = terminees();
+    uint32_t departEmises = canal.stats().sent;
+    uint32_t departVirtuel = millis();
+    uint32_t refusees = 0;
+    size_t prochaine = 0;
+
+    auto debut = std::chrono::steady_clock::now();
+    while(terminees() - departTerminees < parametres.transactions) {
+        bool libre = !transactions.busy() && transactions.pending() == 0 && canal.inFlight() == 0;
+        if(libre) {
+            // Canal au repos : saut direct à l'émission suivante
+            HostShim::advanceMs(parametres.ecartMs);
+            if(!actions[prochaine++ % nbActions]()) {
+                ++refusees;
+            }
+        } else {
+            HostShim::advanceMs(1);
+        }
+
+        manager.loop();
+        chaudiere.loop();
+        if(parametres.verbeux) {
+            logs.drainSerial();
+        }
+    }
+    auto fin = std::chrono::steady_clock::now();
+
+    double secondes = std::chrono::duration<double>(fin - debut).count();
+    uint32_t trames = canal.stats().sent - departEmises;
+    uint32_t nbTransactions = terminees() - departTerminees;
+
+    printf("Transactions : %u (%u réussies, %u échouées, %u relances, %u refusées à la soumission)\n",
+        nbTransactions, transactions.getCompleted(), transactions.getFailed(), transactions.getRetransmissions(), refusees);
+    printf("Trames : %u émises, %u livrées, %u perdues, %u corrompues (%u erreurs CRC côté module)\n",
+        trames, canal.stats().delivered, canal.stats().lost, canal.stats().corrupted, radio.getRxCrcErrorCount());
+    printf("Chaudière : %u lectures, %u écritures, %u refus\n",
+        chaudiere.stats().reads, chaudiere.stats().inits, chaudiere.stats().refused);
+    printf("Budget d'émission : %u trames délestées\n", radio.dutyCycle().stats().delestees);
+    printf("Durée : %.3f s réelles pour %.1f h simulées\n", secondes, (millis() - departVirtuel) / 3600000.0);
+    printf("Débit : %.0f trames/s, %.0f transactions/s\n", trames / secondes, nbTransactions / secondes);
+    return 0;
+}
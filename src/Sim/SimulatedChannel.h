@@ -0,0 +1,105 @@
+#pragma once
+
+#include "../RadioTransport.h"
+#include <deque>
+#include <functional>
+#include <vector>
+
+// Canal radio en mémoire pour poste de développement : chaque trame émise par un
+// point d'accès est livrée aux autres points d'accès du même réseau (mot de synchro),
+// après une latence configurable, avec perte et corruption aléatoires. Comme sur le
+// SX1262, une trame corrompue est remise avec RADIOLIB_ERR_CRC_MISMATCH.
+class SimulatedChannel {
+    public:
+        struct Options {
+            uint32_t latencyMs = 0;         // Délai entre fin d'émission et interruption de réception
+            uint32_t jitterMs = 0;          // Délai supplémentaire aléatoire, 0..jitterMs
+            float lossRate = 0.0f;          // Probabilité de perte par destinataire (0..1)
+            float corruptionRate = 0.0f;    // Probabilité d'erreur CRC (un bit inversé) par destinataire (0..1)
+            uint32_t rxTimeoutMs = 100;     // Échéance d'une réception bloquante
+            float rssi = -60.0f;
+            uint32_t seed = 1;
+        };
+
+        // Trame remise au récepteur, CRC faux si elle a été corrompue en vol
+        struct Packet {
+            std::vector<uint8_t> data;
+            bool crcError = false;
+        };
+
+        class Endpoint : public RadioTransport {
+            public:
+                void init() override {}
+
+                int16_t startReceive() override { _listening = true; return RADIOLIB_ERR_NONE; }
+                int16_t receive(uint8_t data[], size_t len) override;
+                int16_t readData(uint8_t data[], size_t len) override;
+                int16_t transmit(uint8_t data[], size_t len) override;
+                size_t getPacketLength() override { return _packetLength; }
+                float getRSSI() override { return _channel._options.rssi; }
+                bool isChannelFree(float) override { return !_channel.busyFor(*this); }
+                void onReceive(void (*func)()) override { _onReceive = func; }
+                void setSyncWord(uint8_t* syncWord, size_t len) override;
+                void service() override { _channel.poll(); }
+
+                size_t available() const { return _rx.size(); }
+                SimulatedChannel& getChannel() { return _channel; }
+
+            private:
+                friend class SimulatedChannel;
+                explicit Endpoint(SimulatedChannel& channel) : _channel(channel) {}
+
+                SimulatedChannel& _channel;
+                std::vector<uint8_t> _syncWord;
+                std::deque<Packet> _rx;
+                size_t _packetLength = 0;
+                bool _listening = false;
+                void (*_onReceive)() = nullptr;
+        };
+
+        struct Stats {
+            uint32_t sent = 0;
+            uint32_t delivered = 0;
+            uint32_t lost = 0;
+            uint32_t corrupted = 0;
+        };
+
+        SimulatedChannel() : SimulatedChannel(Options()) {}
+        explicit SimulatedChannel(const Options& options);
+        ~SimulatedChannel();
+
+        // Nouveau point d'accès, détenu par le canal
+        Endpoint& createEndpoint();
+
+        // Horloge du canal en millisecondes, horloge système par défaut
+        void setClock(std::function<uint32_t()> clock) { _clock = clock; }
+        uint32_t now() const { return _clock(); }
+
+        // Livre les trames dont la latence est écoulée
+        void poll();
+
+        Options& options() { return _options; }
+        const Stats& stats() const { return _stats; }
+        size_t inFlight() const { return _inFlight.size(); }
+
+        // Une trame destinée à ce point d'accès est encore en vol
+        bool busyFor(const Endpoint& endpoint) const;
+
+    private:
+        struct Delivery {
+            Endpoint* destination;
+            uint32_t dueMs;
+            Packet packet;
+        };
+
+        void broadcast(Endpoint& source, const uint8_t* data, size_t len);
+        uint32_t nextRandom();
+        bool chance(float rate);
+
+        Options _options;
+        Stats _stats;
+        std::function<uint32_t()> _clock;
+        std::vector<Endpoint*> _endpoints;
+        std::deque<Delivery> _inFlight;
+        uint32_t _random;
+};
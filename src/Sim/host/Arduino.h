@@ -0,0 +1,261 @@
+#pragma once
+
+// API Arduino minimale pour compiler le protocole Frisquet sur poste de développement
+// (Linux, macOS). Exécution mono-tâche sur une horloge virtuelle : delay() avance le
+// temps sans attendre et donne la main à HostShim::idle (chaudière émulée, canal).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+typedef uint8_t byte;
+using std::isnan;
+using std::isinf;
+
+#define IRAM_ATTR
+#define ARDUINO_RUNNING_CORE 1
+#define HEX 16
+#define DEC 10
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define GPIO_NUM_33 33
+
+namespace HostShim {
+    // Horloge virtuelle en microsecondes, partagée par millis(), micros() et delay()
+    inline uint64_t clockUs = 0;
+
+    // Appelé à chaque delay() : ce que l'ordonnanceur ferait tourner pendant l'attente
+    inline std::function<void()> idle;
+
+    // Sortie série recopiée sur stdout
+    inline bool serialEcho = false;
+
+    inline void advanceUs(uint64_t us) { clockUs += us; }
+    inline void advanceMs(uint32_t ms) { clockUs += (uint64_t)ms * 1000; }
+}
+
+inline unsigned long millis() { return (unsigned long)(uint32_t)(HostShim::clockUs / 1000); }
+inline unsigned long micros() { return (unsigned long)(uint32_t)HostShim::clockUs; }
+
+inline void delay(unsigned long ms) {
+    HostShim::advanceMs(ms);
+    if(HostShim::idle) {
+        HostShim::idle();
+    }
+}
+inline void delayMicroseconds(unsigned int us) { HostShim::advanceUs(us); }
+inline void yield() {}
+
+inline void pinMode(uint8_t, uint8_t) {}
+
+inline long random(long max) { return max > 0 ? rand() % max : 0; }
+inline long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+
+inline char* dtostrf(double value, signed char width, unsigned char precision, char* out) {
+    sprintf(out, "%*.*f", width, precision, value);
+    return out;
+}
+
+class String {
+    public:
+        String() {}
+        String(const char* s) : _s(s ? s : "") {}
+        String(const std::string& s) : _s(s) {}
+        String(const String& other) = default;
+        String(String&& other) = default;
+        explicit String(char c) : _s(1, c) {}
+        String(int value, unsigned char base = 10) : _s(entier((long long)value, base)) {}
+        String(unsigned int value, unsigned char base = 10) : _s(entier((long long)value, base)) {}
+        String(long value, unsigned char base = 10) : _s(entier((long long)value, base)) {}
+        String(unsigned long value, unsigned char base = 10) : _s(entier((long long)value, base)) {}
+        String(float value, unsigned char decimals = 2) : _s(reel(value, decimals)) {}
+        String(double value, unsigned char decimals = 2) : _s(reel(value, decimals)) {}
+
+        String& operator=(const String& other) = default;
+        String& operator=(String&& other) = default;
+        String& operator=(const char* s) { _s = s ? s : ""; return *this; }
+
+        const char* c_str() const { return _s.c_str(); }
+        unsigned int length() const { return (unsigned int)_s.size(); }
+        bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+        char operator[](unsigned int i) const { return i < _s.size() ? _s[i] : '\0'; }
+        char& operator[](unsigned int i) { return _s[i]; }
+        char charAt(unsigned int i) const { return (*this)[i]; }
+
+        String& operator+=(const String& other) { _s += other._s; return *this; }
+        String& operator+=(const char* s) { if(s) _s += s; return *this; }
+        String& operator+=(char c) { _s += c; return *this; }
+        String& operator+=(int value) { _s += entier(value, 10); return *this; }
+        String& operator+=(unsigned int value) { _s += entier(value, 10); return *this; }
+        String& operator+=(long value) { _s += entier(value, 10); return *this; }
+        String& operator+=(unsigned long value) { _s += entier((long long)value, 10); return *this; }
+        String& operator+=(float value) { _s += reel(value, 2); return *this; }
+        String& operator+=(double value) { _s += reel(value, 2); return *this; }
+        bool concat(const String& other) { _s += other._s; return true; }
+        bool concat(const char* s) { if(s) _s += s; return true; }
+        bool concat(char c) { _s += c; return true; }
+
+        bool operator==(const String& other) const { return _s == other._s; }
+        bool operator==(const char* s) const { return _s == (s ? s : ""); }
+        bool operator!=(const String& other) const { return _s != other._s; }
+        bool operator!=(const char* s) const { return !(*this == s); }
+        bool operator<(const String& other) const { return _s < other._s; }
+        bool equals(const String& other) const { return _s == other._s; }
+        bool equalsIgnoreCase(const String& other) const {
+            return _s.size() == other._s.size() && std::equal(_s.begin(), _s.end(), other._s.begin(), [](char a, char b) {
+                return tolower((unsigned char)a) == tolower((unsigned char)b);
+            });
+        }
+        bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+        bool endsWith(const String& suffix) const {
+            return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+        }
+
+        int indexOf(char c, unsigned int from = 0) const { return position(_s.find(c, from)); }
+        int indexOf(const String& s, unsigned int from = 0) const { return position(_s.find(s._s, from)); }
+        int lastIndexOf(char c) const { return position(_s.rfind(c)); }
+        String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+        String substring(unsigned int from, unsigned int to) const {
+            if(from > to) std::swap(from, to);
+            return from < _s.size() ? String(_s.substr(from, to - from)) : String();
+        }
+
+        void replace(const String& from, const String& to) {
+            if(from._s.empty()) return;
+            for(size_t i = _s.find(from._s); i != std::string::npos; i = _s.find(from._s, i + to._s.size())) {
+                _s.replace(i, from._s.size(), to._s);
+            }
+        }
+        void trim() {
+            size_t debut = _s.find_first_not_of(" \t\r\n");
+            size_t fin = _s.find_last_not_of(" \t\r\n");
+            _s = debut == std::string::npos ? std::string() : _s.substr(debut, fin - debut + 1);
+        }
+        void toLowerCase() { for(char& c : _s) c = (char)tolower((unsigned char)c); }
+        void toUpperCase() { for(char& c : _s) c = (char)toupper((unsigned char)c); }
+
+        long toInt() const { return atol(_s.c_str()); }
+        float toFloat() const { return (float)atof(_s.c_str()); }
+        double toDouble() const { return atof(_s.c_str()); }
+
+    private:
+        static std::string entier(long long value, unsigned char base) {
+            char buff[32];
+            if(base == 16) {
+                snprintf(buff, sizeof(buff), "%llx", (unsigned long long)value);
+            } else {
+                snprintf(buff, sizeof(buff), "%lld", value);
+            }
+            return buff;
+        }
+        static std::string reel(double value, unsigned char decimals) {
+            char buff[64];
+            snprintf(buff, sizeof(buff), "%.*f", decimals, value);
+            return buff;
+        }
+        static int position(size_t i) { return i == std::string::npos ? -1 : (int)i; }
+
+        std::string _s;
+};
+
+inline String operator+(const String& a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, const char* b) { String s(a); s += b; return s; }
+inline String operator+(const char* a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, char b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, int b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, unsigned int b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, long b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, unsigned long b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, float b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, double b) { String s(a); s += b; return s; }
+
+class Print {
+    public:
+        virtual ~Print() {}
+        virtual size_t write(uint8_t c) { return write(&c, 1); }
+        virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+
+        size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+        size_t print(const String& s) { return print(s.c_str()); }
+        size_t println(const char* s = "") { return print(s) + print("\r\n"); }
+        size_t println(const String& s) { return println(s.c_str()); }
+        size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+            char buff[512];
+            va_list args;
+            va_start(args, fmt);
+            int n = vsnprintf(buff, sizeof(buff), fmt, args);
+            va_end(args);
+            return n > 0 ? write((const uint8_t*)buff, std::min((size_t)n, sizeof(buff) - 1)) : 0;
+        }
+};
+
+class HardwareSerial : public Print {
+    public:
+        void begin(unsigned long) {}
+        void flush() { fflush(stdout); }
+        int availableForWrite() { return 4096; }
+        using Print::write;
+        size_t write(const uint8_t* buffer, size_t size) override {
+            if(HostShim::serialEcho) {
+                fwrite(buffer, 1, size, stdout);
+            }
+            return size;
+        }
+};
+
+inline HardwareSerial Serial;
+
+class IPAddress {
+    public:
+        IPAddress() {}
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _octets{a, b, c, d} {}
+        uint8_t operator[](int i) const { return _octets[i]; }
+        operator uint32_t() const { return (uint32_t)_octets[0] | _octets[1] << 8 | _octets[2] << 16 | (uint32_t)_octets[3] << 24; }
+        bool fromString(const String& s) {
+            unsigned a, b, c, d;
+            if(sscanf(s.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4) return false;
+            *this = IPAddress(a, b, c, d);
+            return true;
+        }
+        String toString() const {
+            char buff[16];
+            snprintf(buff, sizeof(buff), "%u.%u.%u.%u", _octets[0], _octets[1], _octets[2], _octets[3]);
+            return buff;
+        }
+
+    private:
+        uint8_t _octets[4] = {0, 0, 0, 0};
+};
+
+// Client réseau jamais connecté : MQTT hors ligne sur poste
+class Client : public Print {
+    public:
+        using Print::write;
+        size_t write(const uint8_t*, size_t) override { return 0; }
+        int connect(const char*, uint16_t) { return 0; }
+        uint8_t connected() { return 0; }
+        void stop() {}
+};
+
+struct EspClass {
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getMinFreeHeap() { return 256 * 1024; }
+    void restart() { exit(0); }
+};
+
+inline EspClass ESP;
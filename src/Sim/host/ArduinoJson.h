@@ -0,0 +1,231 @@
+#pragma once
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Sous-ensemble d'ArduinoJson 7 utilisé par la discovery et les diagnostics MQTT :
+// arbre de valeurs, construction par [] / add / to<>, sérialisation compacte.
+// deserializeJson() conserve le texte tel quel (fragment brut recopié à la sérialisation).
+struct JsonNode {
+    enum TYPE : uint8_t { NUL, BOOLEEN, ENTIER, REEL, CHAINE, BRUT, TABLEAU, OBJET };
+
+    TYPE type = NUL;
+    bool booleen = false;
+    long long entier = 0;
+    double reel = 0.0;
+    std::string chaine;
+    std::vector<std::pair<std::string, std::shared_ptr<JsonNode>>> membres;
+    std::vector<std::shared_ptr<JsonNode>> elements;
+
+    void vider(TYPE nouveau) {
+        type = nouveau;
+        chaine.clear();
+        membres.clear();
+        elements.clear();
+    }
+
+    void ecrire(std::string& out) const {
+        switch(type) {
+            case NUL: out += "null"; break;
+            case BOOLEEN: out += booleen ? "true" : "false"; break;
+            case ENTIER: out += std::to_string(entier); break;
+            case REEL: {
+                if(std::isnan(reel) || std::isinf(reel)) {
+                    out += "null";
+                    break;
+                }
+                char buff[32];
+                snprintf(buff, sizeof(buff), "%.9g", reel);
+                out += buff;
+                break;
+            }
+            case CHAINE: echapper(chaine, out); break;
+            case BRUT: out += chaine; break;
+            case TABLEAU:
+                out += '[';
+                for(size_t i = 0; i < elements.size(); i++) {
+                    if(i) out += ',';
+                    elements[i]->ecrire(out);
+                }
+                out += ']';
+                break;
+            case OBJET:
+                out += '{';
+                for(size_t i = 0; i < membres.size(); i++) {
+                    if(i) out += ',';
+                    echapper(membres[i].first, out);
+                    out += ':';
+                    membres[i].second->ecrire(out);
+                }
+                out += '}';
+                break;
+        }
+    }
+
+    static void echapper(const std::string& s, std::string& out) {
+        out += '"';
+        for(char c : s) {
+            switch(c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if((unsigned char)c < 0x20) {
+                        char buff[8];
+                        snprintf(buff, sizeof(buff), "\\u%04x", c);
+                        out += buff;
+                    } else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+};
+
+class JsonArray;
+class JsonObject;
+
+// Référence vers un nœud : la copie partage le nœud, l'affectation d'une valeur le remplace
+class JsonVariant {
+    public:
+        JsonVariant() : _node(std::make_shared<JsonNode>()) {}
+        JsonVariant(const JsonVariant& other) = default;
+        explicit JsonVariant(std::shared_ptr<JsonNode> node) : _node(std::move(node)) {}
+
+        JsonVariant& operator=(const JsonVariant& other) {
+            if(_node != other._node) {
+                *_node = *other._node;
+            }
+            return *this;
+        }
+        JsonVariant& operator=(bool value) { _node->vider(JsonNode::BOOLEEN); _node->booleen = value; return *this; }
+        JsonVariant& operator=(const char* value) { _node->vider(JsonNode::CHAINE); _node->chaine = value ? value : ""; return *this; }
+        JsonVariant& operator=(const String& value) { return *this = value.c_str(); }
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+        JsonVariant& operator=(T value) { _node->vider(JsonNode::ENTIER); _node->entier = (long long)value; return *this; }
+
+        template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+        JsonVariant& operator=(T value) { _node->vider(JsonNode::REEL); _node->reel = value; return *this; }
+
+        JsonVariant operator[](const char* key) const { return membre(key); }
+        JsonVariant operator[](const String& key) const { return membre(key.c_str()); }
+
+        template <typename T> T to() const;
+        template <typename T> T as() const;
+
+        bool isNull() const { return _node->type == JsonNode::NUL; }
+
+        std::shared_ptr<JsonNode> node() const { return _node; }
+
+    protected:
+        JsonVariant membre(const char* key) const {
+            if(_node->type != JsonNode::OBJET) {
+                _node->vider(JsonNode::OBJET);
+            }
+            for(auto& membre : _node->membres) {
+                if(membre.first == key) {
+                    return JsonVariant(membre.second);
+                }
+            }
+            _node->membres.emplace_back(key, std::make_shared<JsonNode>());
+            return JsonVariant(_node->membres.back().second);
+        }
+
+        std::shared_ptr<JsonNode> _node;
+};
+
+class JsonObject : public JsonVariant {
+    public:
+        JsonObject() {}
+        explicit JsonObject(std::shared_ptr<JsonNode> node) : JsonVariant(std::move(node)) {}
+        using JsonVariant::operator=;
+};
+
+class JsonArray : public JsonVariant {
+    public:
+        JsonArray() {}
+        explicit JsonArray(std::shared_ptr<JsonNode> node) : JsonVariant(std::move(node)) {}
+        using JsonVariant::operator=;
+
+        template <typename T>
+        bool add(const T& value) {
+            JsonVariant element(nouvelElement());
+            element = value;
+            return true;
+        }
+
+        template <typename T>
+        T add() { return T(nouvelElement()); }
+
+    private:
+        std::shared_ptr<JsonNode> nouvelElement() {
+            if(_node->type != JsonNode::TABLEAU) {
+                _node->vider(JsonNode::TABLEAU);
+            }
+            _node->elements.push_back(std::make_shared<JsonNode>());
+            return _node->elements.back();
+        }
+};
+
+template <typename T>
+T JsonVariant::to() const {
+    _node->vider(std::is_same<T, JsonArray>::value ? JsonNode::TABLEAU : std::is_same<T, JsonObject>::value ? JsonNode::OBJET : JsonNode::NUL);
+    return T(_node);
+}
+
+template <typename T>
+T JsonVariant::as() const { return T(_node); }
+
+class JsonDocument : public JsonVariant {
+    public:
+        JsonDocument() {}
+        using JsonVariant::operator=;
+};
+
+struct DeserializationError {
+    enum Code { Ok, EmptyInput };
+
+    DeserializationError(Code code) : _code(code) {}
+    bool operator==(Code code) const { return _code == code; }
+    bool operator!=(Code code) const { return _code != code; }
+
+    private:
+        Code _code;
+};
+
+inline DeserializationError deserializeJson(JsonDocument& doc, const String& input) {
+    if(input.length() == 0) {
+        return DeserializationError::EmptyInput;
+    }
+    std::shared_ptr<JsonNode> node = doc.node();
+    node->vider(JsonNode::BRUT);
+    node->chaine = input.c_str();
+    return DeserializationError::Ok;
+}
+
+inline size_t serializeJson(const JsonVariant& doc, char* output, size_t size) {
+    if(size == 0) {
+        return 0;
+    }
+    std::string texte;
+    doc.node()->ecrire(texte);
+    size_t n = std::min(texte.size(), size - 1);
+    memcpy(output, texte.data(), n);
+    output[n] = '\0';
+    return n;
+}
+
+inline size_t serializeJson(const JsonVariant& doc, String& output) {
+    std::string texte;
+    doc.node()->ecrire(texte);
+    output = String(texte);
+    return texte.size();
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <OneWire.h>
+
+#define DEVICE_DISCONNECTED_C -127
+
+typedef uint8_t DeviceAddress[8];
+
+// Aucune sonde DS18B20 sur le bus : la sonde extérieure garde sa température manuelle
+class DallasTemperature {
+    public:
+        DallasTemperature() {}
+        explicit DallasTemperature(OneWire*) {}
+        void begin() {}
+        uint8_t getDeviceCount() { return 0; }
+        bool getAddress(uint8_t*, uint8_t) { return false; }
+        bool setResolution(const uint8_t*, uint8_t) { return false; }
+        bool requestTemperaturesByAddress(const uint8_t*) { return false; }
+        float getTempC(const uint8_t*) { return DEVICE_DISCONNECTED_C; }
+};
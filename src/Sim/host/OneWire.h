@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Bus OneWire sans périphérique
+class OneWire {
+    public:
+        OneWire() {}
+        explicit OneWire(uint8_t) {}
+};
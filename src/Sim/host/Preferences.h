@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// NVS en mémoire : un espace de noms par begin(), conservé le temps de l'exécution.
+// HostShim::preferences permet de préparer la configuration avant le démarrage.
+namespace HostShim {
+    typedef std::map<std::string, std::vector<uint8_t>> PreferencesNamespace;
+    inline std::map<std::string, PreferencesNamespace> preferences;
+}
+
+class Preferences {
+    public:
+        bool begin(const char* name, bool readOnly = false) {
+            _espace = &HostShim::preferences[name];
+            _lectureSeule = readOnly;
+            return true;
+        }
+        bool begin(const String& name, bool readOnly = false) { return begin(name.c_str(), readOnly); }
+        void end() { _espace = nullptr; }
+
+        bool clear() { if(!modifiable()) return false; _espace->clear(); return true; }
+        bool remove(const char* key) { return modifiable() && _espace->erase(key) > 0; }
+        bool isKey(const char* key) { return _espace && _espace->count(key) > 0; }
+
+        size_t putChar(const char* key, int8_t value) { return put(key, value); }
+        size_t putUChar(const char* key, uint8_t value) { return put(key, value); }
+        size_t putShort(const char* key, int16_t value) { return put(key, value); }
+        size_t putUShort(const char* key, uint16_t value) { return put(key, value); }
+        size_t putInt(const char* key, int32_t value) { return put(key, value); }
+        size_t putUInt(const char* key, uint32_t value) { return put(key, value); }
+        size_t putLong(const char* key, int32_t value) { return put(key, value); }
+        size_t putULong(const char* key, uint32_t value) { return put(key, value); }
+        size_t putFloat(const char* key, float value) { return put(key, value); }
+        size_t putBool(const char* key, bool value) { return put(key, (uint8_t)value); }
+        size_t putString(const char* key, const char* value) { return putBytes(key, value, strlen(value) + 1); }
+        size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+        size_t putBytes(const char* key, const void* value, size_t length) {
+            if(!modifiable()) return 0;
+            const uint8_t* octets = (const uint8_t*)value;
+            (*_espace)[key].assign(octets, octets + length);
+            return length;
+        }
+
+        int8_t getChar(const char* key, int8_t defaut = 0) { return get(key, defaut); }
+        uint8_t getUChar(const char* key, uint8_t defaut = 0) { return get(key, defaut); }
+        int16_t getShort(const char* key, int16_t defaut = 0) { return get(key, defaut); }
+        uint16_t getUShort(const char* key, uint16_t defaut = 0) { return get(key, defaut); }
+        int32_t getInt(const char* key, int32_t defaut = 0) { return get(key, defaut); }
+        uint32_t getUInt(const char* key, uint32_t defaut = 0) { return get(key, defaut); }
+        int32_t getLong(const char* key, int32_t defaut = 0) { return get(key, defaut); }
+        uint32_t getULong(const char* key, uint32_t defaut = 0) { return get(key, defaut); }
+        float getFloat(const char* key, float defaut = NAN) { return get(key, defaut); }
+        bool getBool(const char* key, bool defaut = false) { return get(key, (uint8_t)defaut) != 0; }
+        String getString(const char* key, const String& defaut = String()) {
+            const std::vector<uint8_t>* valeur = trouver(key);
+            return valeur && !valeur->empty() ? String((const char*)valeur->data()) : defaut;
+        }
+        size_t getBytesLength(const char* key) {
+            const std::vector<uint8_t>* valeur = trouver(key);
+            return valeur ? valeur->size() : 0;
+        }
+        size_t getBytes(const char* key, void* buffer, size_t length) {
+            const std::vector<uint8_t>* valeur = trouver(key);
+            if(!valeur || valeur->size() > length) return 0;
+            memcpy(buffer, valeur->data(), valeur->size());
+            return valeur->size();
+        }
+
+    private:
+        bool modifiable() const { return _espace && !_lectureSeule; }
+
+        const std::vector<uint8_t>* trouver(const char* key) const {
+            if(!_espace) return nullptr;
+            auto it = _espace->find(key);
+            return it != _espace->end() ? &it->second : nullptr;
+        }
+
+        template <typename T>
+        size_t put(const char* key, T value) { return putBytes(key, &value, sizeof(value)); }
+
+        template <typename T>
+        T get(const char* key, T defaut) {
+            const std::vector<uint8_t>* valeur = trouver(key);
+            if(!valeur || valeur->size() != sizeof(T)) return defaut;
+            T resultat;
+            memcpy(&resultat, valeur->data(), sizeof(T));
+            return resultat;
+        }
+
+        HostShim::PreferencesNamespace* _espace = nullptr;
+        bool _lectureSeule = false;
+};
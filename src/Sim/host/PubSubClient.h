@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Client MQTT hors ligne : les publications sont comptées puis abandonnées
+class PubSubClient {
+    public:
+        typedef std::function<void(char*, uint8_t*, unsigned int)> Callback;
+
+        PubSubClient& setClient(Client&) { return *this; }
+        PubSubClient& setServer(const char*, uint16_t) { return *this; }
+        PubSubClient& setKeepAlive(uint16_t) { return *this; }
+        PubSubClient& setSocketTimeout(uint16_t) { return *this; }
+        PubSubClient& setCallback(Callback callback) { _callback = callback; return *this; }
+        bool setBufferSize(uint16_t) { return true; }
+
+        bool connect(const char*, const char*, const char*, const char*, uint8_t, bool, const char*, bool) { return false; }
+        bool connected() { return false; }
+        bool loop() { return false; }
+        bool subscribe(const char*) { return false; }
+        bool publish(const char*, const uint8_t*, unsigned int, bool) { ++_publications; return false; }
+
+        uint32_t publications() const { return _publications; }
+
+    private:
+        Callback _callback;
+        uint32_t _publications = 0;
+};
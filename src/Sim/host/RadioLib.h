@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Codes d'erreur RadioLib utilisés par le protocole ; le SX1262 est remplacé par SimulatedChannel
+#define RADIOLIB_ERR_NONE                   (0)
+#define RADIOLIB_ERR_UNKNOWN                (-1)
+#define RADIOLIB_ERR_PACKET_TOO_LONG        (-4)
+#define RADIOLIB_ERR_TX_TIMEOUT             (-5)
+#define RADIOLIB_ERR_RX_TIMEOUT             (-6)
+#define RADIOLIB_ERR_CRC_MISMATCH           (-7)
+#define RADIOLIB_ERR_ADDRESS_NOT_FOUND      (-17)
+#define RADIOLIB_SX126X_MAX_PACKET_LENGTH   255
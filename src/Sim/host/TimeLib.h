@@ -0,0 +1,31 @@
+#pragma once
+
+#include <time.h>
+#include "Arduino.h"
+
+// Heure système de TimeLib, réglée par setTime() et avancée avec l'horloge virtuelle
+namespace HostShim {
+    inline time_t timeBase = 0;
+    inline uint32_t timeBaseMs = 0;
+}
+
+inline time_t now() { return HostShim::timeBase + (time_t)((millis() - HostShim::timeBaseMs) / 1000); }
+
+inline void setTime(time_t t) {
+    HostShim::timeBase = t;
+    HostShim::timeBaseMs = millis();
+}
+
+inline void setTime(int hr, int min, int sec, int day, int month, int yr) {
+    if(yr < 100) {
+        yr += 2000;
+    }
+    struct tm date = {};
+    date.tm_year = yr - 1900;
+    date.tm_mon = month - 1;
+    date.tm_mday = day;
+    date.tm_hour = hr;
+    date.tm_min = min;
+    date.tm_sec = sec;
+    setTime(timegm(&date));
+}
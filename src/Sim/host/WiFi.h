@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Pas de WiFi sur poste : jamais connecté
+typedef int wifi_event_id_t;
+
+struct WiFiClass {
+    bool isConnected() { return false; }
+    IPAddress localIP() { return IPAddress(); }
+    String macAddress() { return "00:00:00:00:00:00"; }
+    int32_t RSSI() { return 0; }
+    String SSID() { return String(); }
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <WiFi.h>
+
+class WiFiClient : public Client {};
@@ -0,0 +1,28 @@
+#pragma once
+
+// FreeRTOS réduit à une seule tâche : les files sont des tampons en mémoire, les
+// sections critiques et les notifications ne bloquent jamais.
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+struct portMUX_TYPE { int verrou; };
+
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+#define portYIELD_FROM_ISR(...) ((void)0)
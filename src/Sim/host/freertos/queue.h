@@ -0,0 +1,41 @@
+#pragma once
+
+#include "FreeRTOS.h"
+#include <deque>
+#include <string.h>
+#include <vector>
+
+// File bornée d'éléments copiés octet par octet, comme xQueueSend/xQueueReceive
+struct HostQueue {
+    UBaseType_t capacity;
+    UBaseType_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t capacity, UBaseType_t itemSize) {
+    return new HostQueue{ capacity, itemSize, {} };
+}
+inline void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t) {
+    if(queue->items.size() >= queue->capacity) {
+        return pdFALSE;     // Aucune autre tâche ne videra la file pendant l'attente
+    }
+    const uint8_t* octets = (const uint8_t*)item;
+    queue->items.emplace_back(octets, octets + queue->itemSize);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t) {
+    if(queue->items.empty()) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) { return (UBaseType_t)queue->items.size(); }
+inline UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) { return queue->capacity - (UBaseType_t)queue->items.size(); }
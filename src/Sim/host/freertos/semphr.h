@@ -0,0 +1,14 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Sémaphores d'une exécution mono-tâche : toujours disponibles
+struct HostSemaphore { bool pris; };
+
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore{ false }; }
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore{ true }; }
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t) { semaphore->pris = true; return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) { semaphore->pris = false; return pdTRUE; }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Tâche unique : son identifiant est toujours le même, aucune autre tâche n'est créée
+typedef void* TaskHandle_t;
+
+namespace HostShim {
+    inline int mainTask;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return &HostShim::mainTask; }
+
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*, BaseType_t) {
+    return pdFAIL;
+}
+inline void vTaskDelete(TaskHandle_t) {}
+
+inline void delay(unsigned long ms);   // Arduino.h : horloge virtuelle
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t* woken) { if(woken) *woken = pdFALSE; }
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
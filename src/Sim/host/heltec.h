@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Carte Heltec : rien à initialiser sur poste
+struct HeltecClass {
+    void begin(bool, bool, bool) {}
+};
+
+inline HeltecClass Heltec;